@@ -0,0 +1,365 @@
+/**
+ * @file ClosestPair.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A program for finding the closest pairs of Points in a PointSet.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A program for finding the closest pairs of Points in a PointSet.
+ * Input:       X and Y coordinates from the user via the standard input stream (the same format
+ *              as the ConvexHull program). An optional command line argument K sets the number
+ *              of closest pairs to find (the default is a single pair).
+ * Process:     From the input, the program creates a PointSet which contains all the Points that
+ *              are in the given X,Y coordinates, sorted by the X coordinates. The lines are
+ *              parsed to an array which is sorted and cleared of repetitions before the PointSet
+ *              is built, so reading n Points takes O(n*log(n)) instead of a search per Point.
+ *              It then performs a Sweep-Line Algorithm on the sorted PointSet:
+ *                  We keep a bound on the squared distance of the K-th closest pair found so far,
+ *                  and a window of the Points whose X coordinate is within the bound from the
+ *                  current Point, ordered by their Y coordinate.
+ *                  For each Point in X order we drop the Points that left the window, and check
+ *                  only the Points in the window that are within the bound in their Y coordinate.
+ *                  Every candidate pair that is closer than the bound enters a bounded max-heap
+ *                  of the K best pairs, and the bound shrinks to the top of the heap.
+ *                  Before the sweep, the bound is seeded with the K-th smallest distance among K
+ *                  pairs of neighbours in X order, so the window is never unbounded.
+ *                  For a single pair every Point is compared with a constant number of Points
+ *                  in the window, so the Algorithm runs in O(n*log(n)). For K pairs the running
+ *                  time is O((n + K)*log(n)) on typical inputs.
+ *                  Reference:
+ *                      "Cormen, Leiserson, Rivest & Stein - Introduction to Algorithms", Page 1039.
+ * Output:      Prints to the standard output the closest pairs sorted by their distance, each
+ *              pair as "X1,Y1 X2,Y2 DISTANCE".
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "PointSetInput.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def RESULT_START_OUTPUT "result\n"
+ * @brief A Macro that sets the output beginning for the entire result output.
+ */
+#define RESULT_START_OUTPUT "result\n"
+
+/**
+ * @def PAIR_SEPARATOR " "
+ * @brief A Macro that sets the output for the separator between the Points of a pair.
+ */
+#define PAIR_SEPARATOR " "
+
+/**
+ * @def END_OF_PAIR_OUTPUT "\n"
+ * @brief A Macro that sets the output for the end of a single pair output representation.
+ */
+#define END_OF_PAIR_OUTPUT "\n"
+
+/**
+ * @def DEFAULT_PAIRS_NUMBER 1
+ * @brief A Macro that sets the default number of closest pairs to find.
+ */
+#define DEFAULT_PAIRS_NUMBER 1
+
+/**
+ * @def VALID_ARGUMENTS_NUMBER 2
+ * @brief A Macro that sets the maximal number of command line arguments (including the name).
+ */
+#define VALID_ARGUMENTS_NUMBER 2
+
+/**
+ * @def PAIRS_NUMBER_ARGUMENT 1
+ * @brief A Macro that sets the index of the number of pairs in the command line arguments.
+ */
+#define PAIRS_NUMBER_ARGUMENT 1
+
+/**
+ * @def MINIMAL_COORDINATE std::numeric_limits<Coordinate>::lowest()
+ * @brief A Macro that sets the minimal value of a coordinate, used as a lower bound for searches.
+ */
+#define MINIMAL_COORDINATE std::numeric_limits<Coordinate>::lowest()
+
+/**
+ * @def MINIMAL_INDEX -1
+ * @brief A Macro that sets an index which is smaller than all the indices, used for searches.
+ */
+#define MINIMAL_INDEX -1
+
+/**
+ * @def USAGE_MESSAGE "Usage: ClosestPair [K]"
+ * @brief A Macro that sets the output message in case of invalid command line arguments.
+ */
+#define USAGE_MESSAGE "Usage: ClosestPair [K]"
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief SquaredDistance is the exact type of a squared distance between 2 Points.
+ */
+typedef CoordinateProduct SquaredDistance;
+
+/**
+ * @brief A pair of Points indices in the sorted PointSet, with their squared distance.
+ */
+struct PointPair
+{
+    SquaredDistance distance;  // The squared distance between the Points.
+    int first;  // The index of the first Point in the sorted PointSet.
+    int second;  // The index of the second Point in the sorted PointSet.
+
+    /**
+     * @brief Compares the pairs by their distance, used for ordering the heap of the best pairs.
+     * @param other The pair to compare to.
+     * @return true if this pair is closer than the other pair.
+     */
+    bool operator<(const PointPair& other) const { return distance < other.distance; };
+};
+
+/**
+ * @brief An entry in the Sweep-Line window, ordered by the Y coordinate and then by the X.
+ */
+typedef std::pair<std::pair<Coordinate, Coordinate>, int> WindowEntry;
+
+
+/*-----=  Closest Pair Process  =-----*/
+
+
+/**
+ * @brief Calculates the exact squared distance between 2 given Points.
+ * @param pointA The first Point.
+ * @param pointB The second Point.
+ * @return The squared distance of the Points.
+ */
+static SquaredDistance pointsDistance(const Point& pointA, const Point& pointB)
+{
+    return pointA.squaredDistance(pointB);
+}
+
+/**
+ * @brief Calculates an initial bound on the squared distance of the K-th closest pair.
+ *        The bound is the K-th smallest distance among K distinct pairs of Points which are
+ *        close in the X order, so the real K-th closest pair can only be closer.
+ * @param pointSet The PointSet sorted by the X coordinates.
+ * @param pairsNumber The number of closest pairs to find.
+ * @param bound The bound to set.
+ * @return true if a bound exists, false if the PointSet has less than K pairs at all.
+ */
+static bool seedBound(const PointSet& pointSet, size_t const pairsNumber, SquaredDistance& bound)
+{
+    std::vector<SquaredDistance> candidates;
+    for (int gap = 1; (gap < pointSet.size()) && (candidates.size() < pairsNumber); gap++)
+    {
+        for (int i = 0; (i + gap) < pointSet.size(); i++)
+        {
+            candidates.push_back(pointsDistance(pointSet[i], pointSet[i + gap]));
+        }
+    }
+    if (candidates.size() < pairsNumber)
+    {
+        return false;
+    }
+
+    std::nth_element(candidates.begin(), candidates.begin() + (pairsNumber - 1), candidates.end());
+    bound = candidates[pairsNumber - 1];
+    return true;
+}
+
+/**
+ * @brief Finds the K closest pairs of Points in the given PointSet.
+ *        The Algorithm is specified in the header of this file.
+ * @param pointSet The PointSet sorted by the X coordinates.
+ * @param pairsNumber The number of closest pairs to find.
+ * @return The closest pairs, sorted by their distance.
+ */
+static std::vector<PointPair> getClosestPairs(const PointSet& pointSet, size_t const pairsNumber)
+{
+    std::priority_queue<PointPair> bestPairs;
+    SquaredDistance bound = 0;
+    bool bounded = seedBound(pointSet, pairsNumber, bound);
+
+    std::set<WindowEntry> window;
+    int tail = 0;  // The index of the leftmost Point in the window.
+    for (int i = 0; i < pointSet.size(); i++)
+    {
+        const Point& current = pointSet[i];
+
+        // Drop the Points which are too far in the X coordinate.
+        while (bounded && (tail < i))
+        {
+            CoordinateDifference deltaX = (CoordinateDifference) current.getX()
+                                          - pointSet[tail].getX();
+            if ((SquaredDistance) deltaX * deltaX <= bound)
+            {
+                break;
+            }
+            window.erase(WindowEntry(std::make_pair(pointSet[tail].getY(),
+                                                    pointSet[tail].getX()), tail));
+            tail++;
+        }
+
+        // Check only the Points which are close enough in the Y coordinate.
+        std::set<WindowEntry>::iterator candidate = window.begin();
+        SquaredDistance reach = 0;
+        if (bounded)
+        {
+            reach = (SquaredDistance) std::ceil(std::sqrt((double) bound));
+            SquaredDistance lowest = std::max((SquaredDistance) current.getY() - reach,
+                                              (SquaredDistance) MINIMAL_COORDINATE);
+            candidate = window.lower_bound(WindowEntry(std::make_pair((Coordinate) lowest,
+                                                                      MINIMAL_COORDINATE),
+                                                       MINIMAL_INDEX));
+        }
+        for ( ; candidate != window.end(); ++candidate)
+        {
+            if (bounded && ((SquaredDistance) candidate -> first.first - current.getY() > reach))
+            {
+                break;
+            }
+
+            PointPair pair = {pointsDistance(current, pointSet[candidate -> second]),
+                              candidate -> second, i};
+            if (bestPairs.size() < pairsNumber)
+            {
+                if (!bounded || (pair.distance <= bound))
+                {
+                    bestPairs.push(pair);
+                }
+            }
+            else if (pair.distance < bestPairs.top().distance)
+            {
+                bestPairs.pop();
+                bestPairs.push(pair);
+            }
+
+            if (bestPairs.size() == pairsNumber)
+            {
+                bound = bounded ? std::min(bound, bestPairs.top().distance)
+                                : bestPairs.top().distance;
+                bounded = true;
+                reach = (SquaredDistance) std::ceil(std::sqrt((double) bound));
+            }
+        }
+
+        window.insert(WindowEntry(std::make_pair(current.getY(), current.getX()), i));
+    }
+
+    std::vector<PointPair> result;
+    for ( ; !bestPairs.empty(); bestPairs.pop())
+    {
+        result.push_back(bestPairs.top());
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+
+/*-----=  Output Handling  =-----*/
+
+
+/**
+ * @brief Output the closest pairs to the standard output.
+ * @param pointSet The sorted PointSet which the pairs indices refer to.
+ * @param pairs The closest pairs to output.
+ */
+static void processResult(const PointSet& pointSet, const std::vector<PointPair>& pairs)
+{
+    std::cout << RESULT_START_OUTPUT;
+    for (const PointPair& pair : pairs)
+    {
+        std::cout << pointSet[pair.first].toString() << PAIR_SEPARATOR
+                  << pointSet[pair.second].toString() << PAIR_SEPARATOR
+                  << std::sqrt((double) pair.distance) << END_OF_PAIR_OUTPUT;
+    }
+}
+
+
+/*-----=  Input Handling  =-----*/
+
+
+/**
+ * @brief Reads the "X,Y" lines of the given stream to a PointSet sorted by the X coordinates.
+ *        The Points are collected and sorted first, and the repetitions are dropped in a single
+ *        pass, so the PointSet is built without searching it for every Point.
+ * @param input The stream to read from.
+ * @return The sorted PointSet of the distinct Points.
+ */
+static PointSet receiveSortedInput(std::istream& input)
+{
+    std::vector<Point> points;
+    std::string currentInput;
+    while (std::getline(input, currentInput))
+    {
+        points.push_back(parsePoint(currentInput));
+    }
+    std::sort(points.begin(), points.end(), [](const Point& point1, const Point& point2)
+    {
+        return point1.lessByX(point2);
+    });
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    return PointSet(points.data(), (int) points.size());
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The Main function that runs this program.
+ *        The function receive input from the user, and then create a PointSet with the given data.
+ *        It then finds the closest pairs of that PointSet and output the result.
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments, which may hold the number of pairs to find.
+ * @return 0 when the program ran successfully, otherwise return a non-zero number.
+ */
+int main(int argc, char *argv[])
+{
+    long pairsNumber = DEFAULT_PAIRS_NUMBER;
+    if (argc > VALID_ARGUMENTS_NUMBER)
+    {
+        std::cerr << USAGE_MESSAGE << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (argc == VALID_ARGUMENTS_NUMBER)
+    {
+        char *end = nullptr;
+        pairsNumber = std::strtol(argv[PAIRS_NUMBER_ARGUMENT], &end, 10);
+        if ((*end != '\0') || (pairsNumber < DEFAULT_PAIRS_NUMBER))
+        {
+            std::cerr << USAGE_MESSAGE << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Create the sorted PointSet from the user input.
+    PointSet pointSet = receiveSortedInput(std::cin);
+
+    // Analyze data and get the closest pairs.
+    std::vector<PointPair> pairs = getClosestPairs(pointSet, (size_t) pairsNumber);
+
+    // Printing the result to the standard output.
+    processResult(pointSet, pairs);
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file ConcurrentPointSet.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the ConcurrentPointSet Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the ConcurrentPointSet Class implementation.
+ * Define the ConcurrentPointSet Class methods and fields.
+ * The stripe of a Point is selected by the top bits of its hash, and the hash table inside the
+ * stripe uses the low bits, so the 2 choices are independent.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include "ConcurrentPointSet.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def EMPTY_SET_SIZE 0
+ * @brief A Macro that sets the size for an empty Set.
+ */
+#define EMPTY_SET_SIZE 0
+
+/**
+ * @def HASH_BITS 64
+ * @brief A Macro that sets the number of bits in the hash of a Point.
+ */
+#define HASH_BITS 64
+
+
+/*-----=  ConcurrentPointSet Constructors  =-----*/
+
+
+/**
+ * @brief A Default Constructor for the ConcurrentPointSet, which create a new empty Set.
+ */
+ConcurrentPointSet::ConcurrentPointSet() : _size(EMPTY_SET_SIZE)
+{
+
+}
+
+
+/*-----=  ConcurrentPointSet Methods  =-----*/
+
+
+/**
+ * @brief Returns the stripe which holds the given Point.
+ * @param point The Point.
+ * @return The index of the stripe of the Point.
+ */
+int ConcurrentPointSet::_stripeOf(const Point& point)
+{
+    return (int) (point.hash() >> (HASH_BITS - STRIPES_BITS));
+}
+
+/**
+ * @brief Reserves room for the given number of Points, so the insertions will not rehash.
+ *        Should be called before the insertions start.
+ * @param expectedSize The expected number of Points in the Set.
+ */
+void ConcurrentPointSet::reserve(int const expectedSize)
+{
+    int perStripe = expectedSize / (1 << STRIPES_BITS) + 1;
+    for (Stripe& stripe : _stripes)
+    {
+        std::lock_guard<std::mutex> guard(stripe.lock);
+        stripe.points.reserve(perStripe);
+    }
+}
+
+/**
+ * @brief Adds a given Point to the Set. Safe to call from several threads at the same time.
+ *        If the Point is already in the Set, this method will do nothing.
+ * @param point The new Point to insert.
+ * @return true if the insertion succeed, false otherwise.
+ */
+bool ConcurrentPointSet::add(const Point& point)
+{
+    Stripe& stripe = _stripes[_stripeOf(point)];
+    bool inserted;
+    {
+        std::lock_guard<std::mutex> guard(stripe.lock);
+        inserted = stripe.points.insert(point).second;
+    }
+    if (inserted)
+    {
+        _size.fetch_add(1, std::memory_order_relaxed);
+    }
+    return inserted;
+}
+
+/**
+ * @brief Checks if a given Point is in the Set. Safe to call from several threads at the
+ *        same time.
+ * @param point The Point to find.
+ * @return true if the Point is in the Set, false otherwise.
+ */
+bool ConcurrentPointSet::contains(const Point& point) const
+{
+    const Stripe& stripe = _stripes[_stripeOf(point)];
+    std::lock_guard<std::mutex> guard(stripe.lock);
+    return stripe.points.count(point) != 0;
+}
+
+/**
+ * @brief Hands over the Points of the Set as an ordinary PointSet, in O(n).
+ *        Should be called after all the insertions are done.
+ * @return A PointSet which holds all the Points of the Set.
+ */
+PointSet ConcurrentPointSet::toPointSet() const
+{
+    std::vector<Point> points;
+    points.reserve(size());
+    for (const Stripe& stripe : _stripes)
+    {
+        std::lock_guard<std::mutex> guard(stripe.lock);
+        points.insert(points.end(), stripe.points.begin(), stripe.points.end());
+    }
+
+    // The stripes are disjoint and each of them has no repetitions, so the Points are distinct.
+    return PointSet(points.data(), (int) points.size());
+}
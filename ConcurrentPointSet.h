@@ -0,0 +1,146 @@
+/**
+ * @file ConcurrentPointSet.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the ConcurrentPointSet Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the ConcurrentPointSet Class.
+ * Declaring the ConcurrentPointSet Class, it's methods and fields.
+ * A ConcurrentPointSet is a Set of Points which many threads may add to and query at the same time.
+ * The Points are split by their hash between several stripes, and each stripe has its own lock,
+ * so threads which insert different Points rarely wait for each other.
+ */
+
+
+#ifndef EX1_CONCURRENTPOINTSET_H
+#define EX1_CONCURRENTPOINTSET_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include "PointSet.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def STRIPES_BITS 6
+ * @brief A Macro that sets the number of bits of the stripe index, i.e. there are 2^6 stripes.
+ */
+#define STRIPES_BITS 6
+
+/**
+ * @def CACHE_LINE_SIZE 64
+ * @brief A Macro that sets the size of a cache line, which separates the stripes in memory.
+ */
+#define CACHE_LINE_SIZE 64
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a Set of Points (without repetitions) which is safe to use from
+ *        several threads at the same time. When all the insertions are done, the Points are handed
+ *        over as an ordinary PointSet for sorting and the Convex Hull calculation.
+ */
+class ConcurrentPointSet
+{
+public:
+
+    /**
+     * @brief A Default Constructor for the ConcurrentPointSet, which create a new empty Set.
+     */
+    ConcurrentPointSet();
+
+    /**
+     * @brief The ConcurrentPointSet holds locks, so it can not be copied.
+     */
+    ConcurrentPointSet(const ConcurrentPointSet& other) = delete;
+
+    /**
+     * @brief The ConcurrentPointSet holds locks, so it can not be assigned.
+     */
+    ConcurrentPointSet& operator=(const ConcurrentPointSet& other) = delete;
+
+    /**
+     * @brief Returns the size of the Set, i.e. the current number of elements.
+     * @return The size of the Set.
+     */
+    int size() const { return _size.load(std::memory_order_relaxed); };
+
+    /**
+     * @brief Reserves room for the given number of Points, so the insertions will not rehash.
+     *        Should be called before the insertions start.
+     * @param expectedSize The expected number of Points in the Set.
+     */
+    void reserve(int const expectedSize);
+
+    /**
+     * @brief Adds a given Point to the Set. Safe to call from several threads at the same time.
+     *        If the Point is already in the Set, this method will do nothing.
+     * @param point The new Point to insert.
+     * @return true if the insertion succeed, false otherwise.
+     */
+    bool add(const Point& point);
+
+    /**
+     * @brief Checks if a given Point is in the Set. Safe to call from several threads at the
+     *        same time.
+     * @param point The Point to find.
+     * @return true if the Point is in the Set, false otherwise.
+     */
+    bool contains(const Point& point) const;
+
+    /**
+     * @brief Hands over the Points of the Set as an ordinary PointSet, in O(n).
+     *        Should be called after all the insertions are done.
+     * @return A PointSet which holds all the Points of the Set.
+     */
+    PointSet toPointSet() const;
+
+private:
+
+    /**
+     * @brief A hash function object for the Points, which uses the hash of the Point.
+     */
+    struct PointHash
+    {
+        size_t operator()(const Point& point) const { return (size_t) point.hash(); };
+    };
+
+    /**
+     * @brief A single stripe of the Set: its Points and the lock which guards them.
+     *        Each stripe has its own cache line, so locking one stripe does not slow the others.
+     */
+    struct alignas(CACHE_LINE_SIZE) Stripe
+    {
+        mutable std::mutex lock;
+        std::unordered_set<Point, PointHash> points;
+    };
+
+    // ConcurrentPointSet Private Fields.
+    Stripe _stripes[1 << STRIPES_BITS];  // The stripes of the Set.
+    std::atomic<int> _size;  // The current number of elements in the Set.
+
+    /**
+     * @brief Returns the stripe which holds the given Point.
+     * @param point The Point.
+     * @return The index of the stripe of the Point.
+     */
+    static int _stripeOf(const Point& point);
+};
+
+
+#endif //EX1_CONCURRENTPOINTSET_H
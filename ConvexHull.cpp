@@ -1,203 +1,1007 @@
-/**
- * @file ConvexHull.cpp
- * @author Itai Tagar <itagar>
- * @version 2.4
- * @date 04 Sep 2016
- *
- * @brief A program for calculating the Convex Hull of a PointSet.
- *
- * @section LICENSE
- * This program is free to use in every operation system.
- *
- * @section DESCRIPTION
- * A program for calculating the Convex Hull of a PointSet.
- * Input:       X and Y coordinates from the user via the standard input stream.
- * Process:     From the input, the program creates a PointSet which contains all the Points that
- *              are in the given X,Y coordinates.
- *              It then performs the Graham Scan Algorithm on this PointSet and calculate the
- *              Convex Hull.
- *              The Algorithm runs as follow:
- *                  First, it finds the Point with the minimal Y value
- *                  (if there are 2 we take the one with the minimal X value as a tie breaker).
- *                  Then we sort all the other Points in the PointSet by their Polar Angle
- *                  according to the minimal Point we just found.
- *                  when our Set is sorted, we can start run in a Counter-Clockwise direction
- *                  and for each 3 Points we check if their orientation performs a Counter-Clockwise
- *                  turn or not.
- *                  If the turn is Counter-Clockwise, we continue, otherwise we remove these Points
- *                  that make the bad turn and keep up to the next set of Points.
- *                  We keep doing so until reaching the starting Point again and then we got our
- *                  Convex Hull.
- *                  The Algorithm running time complexity is O(n*log(n)) because we use sorting
- *                  algorithms that run in O(n*log(n)). The running time of the orientation check
- *                  and the first initialization of the PointSet within the user input is O(n).
- *                  So we get O(n*log(n)).
- *                  Reference:
- *                      "Cormen, Leiserson, Rivest & Stein - Introduction to Algorithms", Page 1031.
- * Output:      Prints to the standard output the Points that make the Convex Hull, sorted by their
- *              X coordinate.
- */
-
-/*-----=  Includes  =-----*/
-
-
-#include <iostream>
-#include "PointSet.h"
-
-
-/*-----=  Definitions  =-----*/
-
-
-/**
- * @def RESULT_START_OUTPUT "result\n"
- * @brief A Macro that sets the output beginning for the entire result output.
- */
-#define RESULT_START_OUTPUT "result\n"
-
-/**
- * @def START_INDEX 0
- * @brief A Macro that sets the value for the start index in the input.
- */
-#define START_INDEX 0
-
-/**
- * @def INITIAL_RESULT_SIZE 2
- * @brief A Macro that sets the initial size of the result Set in the Convex Hull algorithm.
- */
-#define INITIAL_RESULT_SIZE 2
-
-
-/*-----=  Input Handling  =-----*/
-
-
-/**
- * @brief Initialize a new Point from a given user input.
- * @param currentInput A string representing the user input, containing the X,Y coordinates.
- * @return A Point with the requested data given from the user input.
- */
-static Point initializePoint(std::string const currentInput)
-{
-    // Parse the current input to the X,Y coordinates.
-    size_t delimiterIndex = currentInput.find(COORDINATES_SEPARATOR);
-    int x = stoi(currentInput.substr(START_INDEX, delimiterIndex));
-    int y = stoi(currentInput.substr(delimiterIndex + 1, std::string::npos));
-
-    // Create a new Point.
-    Point point(x, y);
-    return point;
-}
-
-/**
- * @brief Handle the process of receiving input from the user and creating proper Points from the
- *        given data to the PointSet.
- * @param pointSet The PointSet to add data to.
- */
-static void receiveInput(PointSet& pointSet)
-{
-    std::string currentInput;
-    while (std::getline(std::cin, currentInput))
-    {
-        // Create a new Point from the input.
-        Point point = initializePoint(currentInput);
-        pointSet.add(point);
-    }
-}
-
-
-/*-----=  Convex Hull Process  =-----*/
-
-
-/**
- * @brief Determine if a given 3 Points create a Counter-Clockwise turn.
- *        If the result of the calculation is negative - we get Clockwise turn.
- *        If the result of the calculation is positive - we get Counter-Clockwise turn.
- *        If the result of the calculation is zero - we get Collinear.
- * @param pointA The first point to include in the calculation.
- * @param pointB The second point to include in the calculation.
- * @param pointC The third point to include in the calculation.
- * @return true if the Points make a Counter-Clockwise turn.
- */
-static bool counterClockwise(const Point& pointA, const Point& pointB, const Point& pointC)
-{
-    long result = (pointB.getX() - pointA.getX()) * (pointC.getY() - pointA.getY())
-                   - (pointB.getY() - pointA.getY()) * (pointC.getX() - pointA.getX());
-    return (result > 0);
-}
-
-/**
- * @brief Calculate the Convex Hull of a given PointSet.
- *        The Algorithm is specified in the header of this file.
- * @pointSet The PointSet that contain the Point to calculate their Convex Hull.
- * @return A PointSet which contains the result of the Convex Hull Points.
- */
-static PointSet getConvexHull(PointSet& pointSet)
-{
-    PointSet resultSet;
-    pointSet.sortByPolar();
-
-    int i = 0;  // The index of the given PointSet.
-    int j = 0;  // The index for the result PointSet.
-
-    // Initialize the Result set with the first Points.
-    for ( ; (j < pointSet.size()) && (j < INITIAL_RESULT_SIZE); j++)
-    {
-        resultSet.add(pointSet[j]);
-    }
-
-    // Iterate on the Points in the given PointSet.
-    for (i = INITIAL_RESULT_SIZE ; i < pointSet.size(); i++)
-    {
-        // Every time we encounter a bad turn we remove the Point from the Set.
-        while ((j >= INITIAL_RESULT_SIZE) &&
-               (!counterClockwise(resultSet[j-2], resultSet[j-1], pointSet[i])))
-        {
-            resultSet.remove(resultSet[j-1]);
-            j--;
-        }
-
-        resultSet.add(pointSet[i]);
-        j++;
-    }
-    return resultSet;
-}
-
-
-/*-----=  Output Handling  =-----*/
-
-
-/**
- * @brief Process the result PointSet after the Convex Hull operation, and output it to the
- *        standard output.
- * @param resultSet The result PointSet after the Convex Hull operation.
- */
-static void processResult(PointSet& resultSet)
-{
-    resultSet.sortSet();
-    std::cout << RESULT_START_OUTPUT;
-    std::cout << resultSet.toString();
-}
-
-
-/*-----=  Main  =-----*/
-
-
-/**
- * @brief The Main function that runs this program.
- *        The function receive input from the user, and then create a PointSet with the given data.
- *        It then finds the Convex Hull of that PointSet and output the result.
- * @return 0 when the program ran successfully, otherwise return a non-zero number.
- */
-int main()
-{
-    // Create the PointSet from the user input.
-    PointSet pointSet;
-    receiveInput(pointSet);
-
-    // Analyze data and get the Convex Hull.
-    PointSet resultSet = getConvexHull(pointSet);
-
-    // Printing the result to the standard output.
-    processResult(resultSet);
-
-    return 0;
+/**
+ * @file ConvexHull.cpp
+ * @author Itai Tagar <itagar>
+ * @version 2.4
+ * @date 04 Sep 2016
+ *
+ * @brief A program for calculating the Convex Hull of a PointSet.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A program for calculating the Convex Hull of a PointSet.
+ * Input:       X and Y coordinates from the user via the standard input stream.
+ *              An optional command line argument "--output=MODE" selects what to output:
+ *                  hull        The Convex Hull sorted by the X coordinate (the default).
+ *                  ccw         The Convex Hull in Counter-Clockwise order, starting from the Point
+ *                              with the minimal Y value.
+ *                  diameter    The farthest pair of Points and their distance.
+ *                  width       The Hull edge and the opposite Point which define the minimum
+ *                              width, and the width itself.
+ *                  rectangle   The corners of the minimum area bounding rectangle in
+ *                              Counter-Clockwise order, and its area.
+ *                  contains    For each query Point, whether it is inside the Hull.
+ *                  extreme     For each query direction, the extreme Hull Point in it.
+ *                  layers      Every input Point and the depth of its Convex Layer (1 for the
+ *                              Convex Hull), layer by layer and sorted by the X coordinate in
+ *                              each layer (see 'ConvexLayers.h').
+ *              The diameter, width and rectangle modes run the Rotating Calipers on the
+ *              Counter-Clockwise Hull in O(h).
+ *              The contains and extreme modes read a second stream of "X,Y" queries from the file
+ *              given by "--query=FILE", and answer each query in O(log(h)) with a HullQuery.
+ *              An optional command line argument "--threads=N" parses a regular file input with
+ *              N threads, each one parsing a range of its lines.
+ *              An optional command line argument "--algorithm=NAME" selects the Hull algorithm:
+ *                  auto        Chan's algorithm if a sample predicts a small Hull, and the Graham
+ *                              Scan otherwise (the default).
+ *                  graham      The Graham Scan, in O(n*log(n)).
+ *                  chan        Chan's algorithm, in O(n*log(h)) for a Hull of h Points.
+ *              An optional command line argument "--approximate=EPS" calculates an approximate
+ *              Hull in O(n + k) instead, such that every input Point is within the distance EPS
+ *              from it, and outputs the error bound it achieved after the result.
+ * Process:     From the input, the program creates a PointSet which contains all the Points that
+ *              are in the given X,Y coordinates.
+ *              It then performs the selected Hull algorithm on this PointSet and calculate the
+ *              Convex Hull (see 'HullAlgorithms.cpp').
+ *              An optional command line argument "--snapshot=FILE" reads the Points from a binary
+ *              snapshot instead of the standard input. The snapshot is mapped to memory, and if it
+ *              is sorted its Convex Hull is calculated in place with the Monotone Chain in O(n).
+ *              An optional command line argument "--save=FILE" saves the input Points, sorted, as
+ *              a binary snapshot.
+ *              An optional command line argument "--window=N" (or "--window-seconds=T") streams
+ *              the input instead: after every "--interval=K" input Points (1 by default), and at
+ *              the end of the input, it outputs the Convex Hull of the latest N Points (or of the
+ *              Points of the latest T seconds), which is kept by a WindowedHull.
+ *              An optional command line argument "--serve=PATH" runs the program as a server on
+ *              the Unix domain socket PATH instead: every request (its "X,Y" lines and an empty
+ *              line) is answered with the output of the other options and an empty line, by one
+ *              of "--workers=N" threads (one per core by default). See 'HullServer.h'.
+ *              An optional command line argument "--pipeline" calculates the Convex Hull while
+ *              the input is still being read: a reader thread reads blocks of lines, and
+ *              "--threads=N" parser threads reduce every block to its Hull and merge it to the
+ *              Hull of the previous blocks. See 'HullPipeline.h'.
+ * Output:      Prints to the standard output the Points that make the Convex Hull, sorted by their
+ *              X coordinate (or the result of the selected output mode).
+ */
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <unistd.h>
+#include "ConvexLayers.h"
+#include "HullAlgorithms.h"
+#include "HullPipeline.h"
+#include "HullQuery.h"
+#include "HullServer.h"
+#include "PointSetInput.h"
+#include "RotatingCalipers.h"
+#include "WindowedHull.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def RESULT_START_OUTPUT "result\n"
+ * @brief A Macro that sets the output beginning for the entire result output.
+ */
+#define RESULT_START_OUTPUT "result\n"
+
+/**
+ * @def END_OF_LINE_OUTPUT "\n"
+ * @brief A Macro that sets the output for the end of a single line of the result.
+ */
+#define END_OF_LINE_OUTPUT "\n"
+
+/**
+ * @def OUTPUT_OPTION "--output="
+ * @brief A Macro that sets the prefix of the command line option which selects the output mode.
+ */
+#define OUTPUT_OPTION "--output="
+
+/**
+ * @def QUERY_OPTION "--query="
+ * @brief A Macro that sets the prefix of the command line option which sets the queries stream.
+ */
+#define QUERY_OPTION "--query="
+
+/**
+ * @def ALGORITHM_OPTION "--algorithm="
+ * @brief A Macro that sets the prefix of the command line option which selects the Hull algorithm.
+ */
+#define ALGORITHM_OPTION "--algorithm="
+
+/**
+ * @def APPROXIMATE_OPTION "--approximate="
+ * @brief A Macro that sets the prefix of the command line option which sets the accuracy of an
+ *        approximate Hull.
+ */
+#define APPROXIMATE_OPTION "--approximate="
+
+/**
+ * @def EXACT_HULL 0
+ * @brief A Macro that sets the accuracy value of an exact Hull.
+ */
+#define EXACT_HULL 0
+
+/**
+ * @def SNAPSHOT_OPTION "--snapshot="
+ * @brief A Macro that sets the prefix of the command line option which reads a snapshot.
+ */
+#define SNAPSHOT_OPTION "--snapshot="
+
+/**
+ * @def SAVE_OPTION "--save="
+ * @brief A Macro that sets the prefix of the command line option which saves a snapshot.
+ */
+#define SAVE_OPTION "--save="
+
+/**
+ * @def SERVE_OPTION "--serve="
+ * @brief A Macro that sets the prefix of the command line option which runs the server.
+ */
+#define SERVE_OPTION "--serve="
+
+/**
+ * @def WORKERS_OPTION "--workers="
+ * @brief A Macro that sets the prefix of the command line option which sets the server workers.
+ */
+#define WORKERS_OPTION "--workers="
+
+/**
+ * @def HARDWARE_WORKERS 0
+ * @brief A Macro that sets the number of server workers which means a worker per hardware thread.
+ */
+#define HARDWARE_WORKERS 0
+
+/**
+ * @def WINDOW_OPTION "--window="
+ * @brief A Macro that sets the prefix of the command line option which sets a window of Points.
+ */
+#define WINDOW_OPTION "--window="
+
+/**
+ * @def WINDOW_SECONDS_OPTION "--window-seconds="
+ * @brief A Macro that sets the prefix of the command line option which sets a window of time.
+ */
+#define WINDOW_SECONDS_OPTION "--window-seconds="
+
+/**
+ * @def INTERVAL_OPTION "--interval="
+ * @brief A Macro that sets the prefix of the command line option which sets the number of Points
+ *        between the outputs of a window.
+ */
+#define INTERVAL_OPTION "--interval="
+
+/**
+ * @def NO_WINDOW 0
+ * @brief A Macro that sets the window size (or seconds) value of an input which is not streamed.
+ */
+#define NO_WINDOW 0
+
+/**
+ * @def EVERY_POINT 1
+ * @brief A Macro that sets the default number of Points between the outputs of a window.
+ */
+#define EVERY_POINT 1
+
+/**
+ * @def PIPELINE_OPTION "--pipeline"
+ * @brief A Macro that sets the command line option which calculates the Hull while the input is
+ *        read.
+ */
+#define PIPELINE_OPTION "--pipeline"
+
+/**
+ * @def THREADS_OPTION "--threads="
+ * @brief A Macro that sets the prefix of the command line option which sets the parsing threads.
+ */
+#define THREADS_OPTION "--threads="
+
+/**
+ * @def SINGLE_THREAD 1
+ * @brief A Macro that sets the number of parsing threads of the regular input handling.
+ */
+#define SINGLE_THREAD 1
+
+/**
+ * @def MAXIMAL_THREADS 1024
+ * @brief A Macro that sets the maximal number of parsing threads.
+ */
+#define MAXIMAL_THREADS 1024
+
+/**
+ * @def DECIMAL_BASE 10
+ * @brief A Macro that sets the base of the numbers in the command line arguments.
+ */
+#define DECIMAL_BASE 10
+
+/**
+ * @def QUERY_RESULT_SEPARATOR " "
+ * @brief A Macro that sets the output for the separator between a query and its answer.
+ */
+#define QUERY_RESULT_SEPARATOR " "
+
+/**
+ * @def LAYER_SEPARATOR " "
+ * @brief A Macro that sets the output for the separator between a Point and its layer depth.
+ */
+#define LAYER_SEPARATOR " "
+
+/**
+ * @def ERROR_BOUND_OUTPUT "error bound "
+ * @brief A Macro that sets the output beginning for the error bound of an approximate Hull.
+ */
+#define ERROR_BOUND_OUTPUT "error bound "
+
+/**
+ * @def INSIDE_OUTPUT "inside"
+ * @brief A Macro that sets the answer for a query Point which is inside the Convex Hull.
+ */
+#define INSIDE_OUTPUT "inside"
+
+/**
+ * @def OUTSIDE_OUTPUT "outside"
+ * @brief A Macro that sets the answer for a query Point which is outside the Convex Hull.
+ */
+#define OUTSIDE_OUTPUT "outside"
+
+/**
+ * @def USAGE_MESSAGE
+ * @brief A Macro that sets the output message in case of invalid command line arguments.
+ */
+#define USAGE_MESSAGE "Usage: ConvexHull [--output=hull|ccw|diameter|width|rectangle|layers] " \
+                      "[--algorithm=auto|graham|chan | --approximate=EPS] " \
+                      "[--threads=N | --snapshot=FILE] [--save=FILE]\n" \
+                      "       ConvexHull --pipeline [--threads=N] [--output=MODE] " \
+                      "[--query=FILE]\n" \
+                      "       ConvexHull --output=contains|extreme --query=FILE " \
+                      "[--algorithm=auto|graham|chan | --approximate=EPS] " \
+                      "[--threads=N | --snapshot=FILE] [--save=FILE]\n" \
+                      "       ConvexHull --serve=PATH [--workers=N] [--output=MODE] " \
+                      "[--query=FILE] [--algorithm=auto|graham|chan | --approximate=EPS]\n" \
+                      "       ConvexHull --window=N|--window-seconds=T [--interval=K] " \
+                      "[--output=MODE] [--query=FILE]"
+
+/**
+ * @def SNAPSHOT_ERROR_MESSAGE "Failed to save the snapshot "
+ * @brief A Macro that sets the output message in case the snapshot can not be saved.
+ */
+#define SNAPSHOT_ERROR_MESSAGE "Failed to save the snapshot "
+
+/**
+ * @def QUERY_ERROR_MESSAGE "Failed to open the queries file "
+ * @brief A Macro that sets the error message for a queries file which can not be opened.
+ */
+#define QUERY_ERROR_MESSAGE "Failed to open the queries file "
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The possible output modes of the program.
+ */
+enum OutputMode
+{
+    HULL_OUTPUT,
+    CCW_OUTPUT,
+    DIAMETER_OUTPUT,
+    WIDTH_OUTPUT,
+    RECTANGLE_OUTPUT,
+    CONTAINS_OUTPUT,
+    EXTREME_OUTPUT,
+    LAYERS_OUTPUT
+};
+
+/**
+ * @brief The names of the output modes, in the order of the OutputMode values.
+ */
+static const char *const gOutputModeNames[] = {"hull", "ccw", "diameter", "width", "rectangle",
+                                                      "contains", "extreme", "layers"};
+
+/**
+ * @brief The possible Hull algorithms of the program.
+ */
+enum HullAlgorithm
+{
+    AUTO_ALGORITHM,
+    GRAHAM_ALGORITHM,
+    CHAN_ALGORITHM
+};
+
+/**
+ * @brief The names of the Hull algorithms, in the order of the HullAlgorithm values.
+ */
+static const char *const gAlgorithmNames[] = {"auto", "graham", "chan"};
+
+/**
+ * @brief The options of the program, as given in the command line arguments.
+ */
+struct ProgramOptions
+{
+    OutputMode output;  // The selected output mode.
+    HullAlgorithm algorithm;  // The selected Hull algorithm.
+    double accuracy;  // The error bound of an approximate Hull, or EXACT_HULL.
+    const char *queryFile;  // The path of the queries stream for the query modes, or nullptr.
+    int threads;  // The number of threads which parse the input.
+    const char *snapshotFile;  // The path of the snapshot to read the Points from, or nullptr.
+    const char *saveFile;  // The path of the snapshot to save the Points to, or nullptr.
+    const char *serveSocket;  // The path of the socket to serve on, or nullptr.
+    int workers;  // The number of server workers, or HARDWARE_WORKERS.
+    int windowSize;  // The number of Points in the window of a streamed input, or NO_WINDOW.
+    double windowSeconds;  // The seconds of the window of a streamed input, or NO_WINDOW.
+    int interval;  // The number of streamed Points between the outputs of the window.
+    bool pipeline;  // true if the Hull is calculated while the input is read.
+};
+
+
+/*-----=  Arguments Handling  =-----*/
+
+
+/**
+ * @brief Returns the value of a command line argument of the form "--option=value".
+ * @param argument The command line argument.
+ * @param option The option prefix, including the '=' sign.
+ * @return The value of the argument, or nullptr if the argument is not of the given option.
+ */
+static const char *optionValue(const char *argument, const char *option)
+{
+    if (strncmp(argument, option, strlen(option)) != 0)
+    {
+        return nullptr;
+    }
+    return argument + strlen(option);
+}
+
+/**
+ * @brief Parse a positive count, e.g. a number of threads.
+ * @param value The number as given in the command line.
+ * @param maximal The maximal valid count.
+ * @param count The count to set.
+ * @return true if the value is a valid count, false otherwise.
+ */
+static bool parseCount(const char *value, long const maximal, int& count)
+{
+    char *end = nullptr;
+    long number = strtol(value, &end, DECIMAL_BASE);
+    if ((*value == '\0') || (*end != '\0') || (number < SINGLE_THREAD) || (number > maximal))
+    {
+        return false;
+    }
+    count = (int) number;
+    return true;
+}
+
+/**
+ * @brief Parse the number of parsing threads.
+ * @param value The number as given in the command line.
+ * @param threads The number of threads to set.
+ * @return true if the value is a valid number of threads, false otherwise.
+ */
+static bool parseThreads(const char *value, int& threads)
+{
+    return parseCount(value, MAXIMAL_THREADS, threads);
+}
+
+/**
+ * @brief Parse a positive real number, e.g. the accuracy of an approximate Hull.
+ * @param value The number as given in the command line.
+ * @param number The number to set.
+ * @return true if the value is a positive finite number, false otherwise.
+ */
+static bool parsePositive(const char *value, double& number)
+{
+    char *end = nullptr;
+    double parsed = strtod(value, &end);
+    if ((*value == '\0') || (*end != '\0') || !(parsed > 0) || !std::isfinite(parsed))
+    {
+        return false;
+    }
+    number = parsed;
+    return true;
+}
+
+/**
+ * @brief Parse the name of an output mode.
+ * @param modeName The name of the mode.
+ * @param mode The mode to set.
+ * @return true if the name is of a valid mode, false otherwise.
+ */
+static bool parseOutputMode(const char *modeName, OutputMode& mode)
+{
+    for (int current = HULL_OUTPUT; current <= LAYERS_OUTPUT; current++)
+    {
+        if (strcmp(modeName, gOutputModeNames[current]) == 0)
+        {
+            mode = (OutputMode) current;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Parse the name of a Hull algorithm.
+ * @param algorithmName The name of the algorithm.
+ * @param algorithm The algorithm to set.
+ * @return true if the name is of a valid algorithm, false otherwise.
+ */
+static bool parseAlgorithm(const char *algorithmName, HullAlgorithm& algorithm)
+{
+    for (int current = AUTO_ALGORITHM; current <= CHAN_ALGORITHM; current++)
+    {
+        if (strcmp(algorithmName, gAlgorithmNames[current]) == 0)
+        {
+            algorithm = (HullAlgorithm) current;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Parse the command line arguments to the program options.
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments.
+ * @param options The options to fill.
+ * @return true if all the arguments are valid, false otherwise.
+ */
+static bool parseArguments(int const argc, char *argv[], ProgramOptions& options)
+{
+    options.output = HULL_OUTPUT;
+    options.algorithm = AUTO_ALGORITHM;
+    options.accuracy = EXACT_HULL;
+    options.queryFile = nullptr;
+    options.threads = SINGLE_THREAD;
+    options.snapshotFile = nullptr;
+    options.saveFile = nullptr;
+    options.serveSocket = nullptr;
+    options.workers = HARDWARE_WORKERS;
+    options.windowSize = NO_WINDOW;
+    options.windowSeconds = NO_WINDOW;
+    options.interval = EVERY_POINT;
+    options.pipeline = false;
+    for (int i = 1; i < argc; i++)
+    {
+        const char *value = nullptr;
+        if ((value = optionValue(argv[i], OUTPUT_OPTION)) != nullptr)
+        {
+            if (!parseOutputMode(value, options.output))
+            {
+                return false;
+            }
+        }
+        else if ((value = optionValue(argv[i], ALGORITHM_OPTION)) != nullptr)
+        {
+            if (!parseAlgorithm(value, options.algorithm))
+            {
+                return false;
+            }
+        }
+        else if ((value = optionValue(argv[i], APPROXIMATE_OPTION)) != nullptr)
+        {
+            if (!parsePositive(value, options.accuracy))
+            {
+                return false;
+            }
+        }
+        else if ((value = optionValue(argv[i], QUERY_OPTION)) != nullptr)
+        {
+            options.queryFile = value;
+        }
+        else if ((value = optionValue(argv[i], SNAPSHOT_OPTION)) != nullptr)
+        {
+            options.snapshotFile = value;
+        }
+        else if ((value = optionValue(argv[i], SAVE_OPTION)) != nullptr)
+        {
+            options.saveFile = value;
+        }
+        else if ((value = optionValue(argv[i], SERVE_OPTION)) != nullptr)
+        {
+            options.serveSocket = value;
+        }
+        else if ((value = optionValue(argv[i], WORKERS_OPTION)) != nullptr)
+        {
+            if (!parseThreads(value, options.workers))
+            {
+                return false;
+            }
+        }
+        else if ((value = optionValue(argv[i], WINDOW_OPTION)) != nullptr)
+        {
+            if (!parseCount(value, INT_MAX, options.windowSize))
+            {
+                return false;
+            }
+        }
+        else if ((value = optionValue(argv[i], WINDOW_SECONDS_OPTION)) != nullptr)
+        {
+            if (!parsePositive(value, options.windowSeconds))
+            {
+                return false;
+            }
+        }
+        else if ((value = optionValue(argv[i], INTERVAL_OPTION)) != nullptr)
+        {
+            if (!parseCount(value, INT_MAX, options.interval))
+            {
+                return false;
+            }
+        }
+        else if (strcmp(argv[i], PIPELINE_OPTION) == 0)
+        {
+            options.pipeline = true;
+        }
+        else if ((value = optionValue(argv[i], THREADS_OPTION)) != nullptr)
+        {
+            if (!parseThreads(value, options.threads))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // The query modes are the only modes which read a stream of queries, a snapshot input is not
+    // parsed at all, an approximate Hull has its own algorithm, a server receives its Points
+    // only from its clients, and a streamed input is read serially to a window with its own Hull.
+    // A pipeline reduces its blocks with the Monotone Chain, and only its threads may be set.
+    // The layers need all the input Points, and they are peeled with their own algorithm.
+    bool queryMode = (options.output == CONTAINS_OUTPUT) || (options.output == EXTREME_OUTPUT);
+    bool snapshotInput = (options.snapshotFile != nullptr);
+    bool approximate = (options.accuracy != EXACT_HULL);
+    bool server = (options.serveSocket != nullptr);
+    bool streamed = (options.windowSize != NO_WINDOW) || (options.windowSeconds != NO_WINDOW);
+    bool layers = (options.output == LAYERS_OUTPUT);
+    return (queryMode == (options.queryFile != nullptr)) &&
+           !(snapshotInput && (options.threads != SINGLE_THREAD)) &&
+           !(approximate && (options.algorithm != AUTO_ALGORITHM)) &&
+           !(server && (snapshotInput || (options.saveFile != nullptr) ||
+                        (options.threads != SINGLE_THREAD))) &&
+           (server || (options.workers == HARDWARE_WORKERS)) &&
+           !((options.windowSize != NO_WINDOW) && (options.windowSeconds != NO_WINDOW)) &&
+           !(streamed && (snapshotInput || (options.saveFile != nullptr) || server ||
+                          (options.threads != SINGLE_THREAD) || approximate ||
+                          (options.algorithm != AUTO_ALGORITHM))) &&
+           (streamed || (options.interval == EVERY_POINT)) &&
+           !(options.pipeline && (snapshotInput || (options.saveFile != nullptr) || server ||
+                                  streamed || approximate ||
+                                  (options.algorithm != AUTO_ALGORITHM))) &&
+           !(layers && (server || streamed || options.pipeline || approximate ||
+                        (options.algorithm != AUTO_ALGORITHM)));
+}
+
+
+/*-----=  Output Handling  =-----*/
+
+
+/**
+ * @brief Represent a Point with real coordinates as a string for output use.
+ * @param x The X coordinate.
+ * @param y The Y coordinate.
+ * @return A string representation of the Point.
+ */
+static std::string realPointToString(double const x, double const y)
+{
+    return std::to_string(x) + COORDINATES_SEPARATOR + std::to_string(y);
+}
+
+/**
+ * @brief Output the Rotating Calipers analytics of the given Convex Hull, according to the given
+ *        output mode.
+ * @param hull The non empty Convex Hull in Counter-Clockwise order.
+ * @param mode The output mode, one of the Rotating Calipers modes.
+ * @param output The stream to output to.
+ */
+static void outputAnalytics(const PointSet& hull, OutputMode const mode, std::ostream& output)
+{
+    if (mode == DIAMETER_OUTPUT)
+    {
+        HullDiameter diameter = getHullDiameter(hull);
+        output << diameter.first.toString() << END_OF_LINE_OUTPUT;
+        output << diameter.second.toString() << END_OF_LINE_OUTPUT;
+        output << std::to_string(diameter.length) << END_OF_LINE_OUTPUT;
+    }
+    else if (mode == WIDTH_OUTPUT)
+    {
+        HullWidth width = getHullWidth(hull);
+        output << width.edgeStart.toString() << END_OF_LINE_OUTPUT;
+        output << width.edgeEnd.toString() << END_OF_LINE_OUTPUT;
+        output << width.opposite.toString() << END_OF_LINE_OUTPUT;
+        output << std::to_string(width.width) << END_OF_LINE_OUTPUT;
+    }
+    else
+    {
+        BoundingRectangle rectangle = getMinimumBoundingRectangle(hull);
+        for (int corner = 0; corner < RECTANGLE_CORNERS; corner++)
+        {
+            output << realPointToString(rectangle.cornersX[corner], rectangle.cornersY[corner])
+                      << END_OF_LINE_OUTPUT;
+        }
+        output << std::to_string(rectangle.area) << END_OF_LINE_OUTPUT;
+    }
+}
+
+/**
+ * @brief Answer the queries from the given stream on the given Convex Hull in bulk.
+ *        Each line of the stream holds a single "X,Y" query, which is a Point for the contains
+ *        mode and a direction for the extreme mode.
+ * @param hull The Convex Hull in Counter-Clockwise order.
+ * @param queries The stream of queries.
+ * @param mode The output mode, one of the query modes.
+ * @param output The stream to output to.
+ */
+static void answerQueries(const PointSet& hull, std::istream& queries, OutputMode const mode,
+                          std::ostream& output)
+{
+    HullQuery hullQuery(hull);
+    std::string currentInput;
+    while (std::getline(queries, currentInput))
+    {
+        Point query = parsePoint(currentInput);
+        output << query.toString() << QUERY_RESULT_SEPARATOR;
+        if (mode == CONTAINS_OUTPUT)
+        {
+            output << (hullQuery.contains(query) ? INSIDE_OUTPUT : OUTSIDE_OUTPUT);
+        }
+        else if (hullQuery.size() > 0)
+        {
+            output << hullQuery.extremePoint(query).toString();
+        }
+        output << END_OF_LINE_OUTPUT;
+    }
+}
+
+/**
+ * @brief Process the result PointSet after the Convex Hull operation, and output it to the
+ *        given stream.
+ *        The result is sorted by the X coordinates only in the default output mode, all the other
+ *        modes need the Counter-Clockwise order of the Convex Hull operation.
+ * @param resultSet The result PointSet after the Convex Hull operation.
+ * @param options The program options.
+ * @param errorBound The error bound of an approximate Hull.
+ * @param output The stream to output to.
+ */
+static void processResult(PointSet& resultSet, const ProgramOptions& options,
+                          double const errorBound, std::ostream& output)
+{
+    OutputMode mode = options.output;
+    output << RESULT_START_OUTPUT;
+    if (mode == HULL_OUTPUT)
+    {
+        resultSet.sortSet();
+        output << resultSet.toString();
+    }
+    else if (mode == CCW_OUTPUT)
+    {
+        output << resultSet.toString();
+    }
+    else if ((mode == CONTAINS_OUTPUT) || (mode == EXTREME_OUTPUT))
+    {
+        std::ifstream queries(options.queryFile);
+        answerQueries(resultSet, queries, mode, output);
+    }
+    else if (resultSet.size() > 0)
+    {
+        outputAnalytics(resultSet, mode, output);
+    }
+    if (options.accuracy != EXACT_HULL)
+    {
+        output << ERROR_BOUND_OUTPUT << std::to_string(errorBound) << END_OF_LINE_OUTPUT;
+    }
+}
+
+/**
+ * @brief Output the given Points with the depths of their Convex Layers, from the Convex Hull
+ *        inwards, where the Points of every layer are sorted by their X coordinate.
+ * @param points The view of the input Points.
+ * @param output The stream to output to.
+ */
+static void outputLayers(PointSetView const points, std::ostream& output)
+{
+    std::vector<int> depths = getConvexLayers(points);
+    std::vector<int> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&points, &depths](int const index1, int const index2)
+              {
+                  return (depths[index1] != depths[index2]) ? (depths[index1] < depths[index2]) :
+                         points[index1].lessByX(points[index2]);
+              });
+    output << RESULT_START_OUTPUT;
+    for (int index : order)
+    {
+        output << points[index].toString() << LAYER_SEPARATOR << depths[index]
+               << END_OF_LINE_OUTPUT;
+    }
+}
+
+
+/*-----=  Hull Handling  =-----*/
+
+
+/**
+ * @brief Checks whether Chan's algorithm should calculate the Convex Hull of the given Points.
+ * @param points The view of the Points.
+ * @param algorithm The selected Hull algorithm.
+ * @return true if Chan's algorithm should be used, false for the Graham Scan.
+ */
+static bool useChan(PointSetView const points, HullAlgorithm const algorithm)
+{
+    return (algorithm == CHAN_ALGORITHM) ||
+           ((algorithm == AUTO_ALGORITHM) && preferChanConvexHull(points));
+}
+
+/**
+ * @brief Calculate the approximate Convex Hull of the given Points.
+ * @param points The view of the Points.
+ * @param accuracy The required error bound.
+ * @param errorBound The error bound to set to the achieved one.
+ * @return A PointSet which contains the result of the approximate Convex Hull Points.
+ */
+static PointSet approximateHull(PointSetView const points, double const accuracy,
+                                double& errorBound)
+{
+    ApproximateHull approximate = getApproximateConvexHull(points, accuracy);
+    errorBound = approximate.errorBound;
+    return approximate.hull;
+}
+
+/**
+ * @brief Calculate the Convex Hull of the given input Points with the selected algorithm.
+ * @param pointSet The input Points, which the Graham Scan may reorder.
+ * @param options The program options.
+ * @param errorBound The error bound to set for an approximate Hull.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+static PointSet calculateHull(PointSet& pointSet, const ProgramOptions& options,
+                              double& errorBound)
+{
+    if (options.accuracy != EXACT_HULL)
+    {
+        return approximateHull(pointSet, options.accuracy, errorBound);
+    }
+    if (useChan(pointSet, options.algorithm))
+    {
+        return getChanConvexHull(pointSet);
+    }
+    return getConvexHull(pointSet);
+}
+
+/**
+ * @brief Calculate the Convex Hull of the Points of the given snapshot with the selected
+ *        algorithm. The Points of a sorted snapshot always use the Monotone Chain in O(n).
+ * @param snapshot The snapshot.
+ * @param options The program options.
+ * @param errorBound The error bound to set for an approximate Hull.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+static PointSet calculateHull(const MappedPointSet& snapshot, const ProgramOptions& options,
+                              double& errorBound)
+{
+    PointSetView points(snapshot.points(), snapshot.size());
+    if (options.accuracy != EXACT_HULL)
+    {
+        return approximateHull(points, options.accuracy, errorBound);
+    }
+    if (!snapshot.isSorted() && useChan(points, options.algorithm))
+    {
+        return getChanConvexHull(points);
+    }
+    return getConvexHull(snapshot);
+}
+
+
+/*-----=  Snapshot Handling  =-----*/
+
+
+/**
+ * @brief Saves the given input Points as a sorted snapshot, so reading it back calculates the
+ *        Convex Hull in O(n).
+ * @param pointSet The input Points (a copy, which shares the storage until it is sorted).
+ * @param path The path of the snapshot file.
+ * @return true if the snapshot was saved, false otherwise.
+ */
+static bool saveInput(PointSet pointSet, const char *path)
+{
+    pointSet.sortSet();
+    if (!writeSnapshot(pointSet, path))
+    {
+        std::cerr << SNAPSHOT_ERROR_MESSAGE << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+/*-----=  Server Handling  =-----*/
+
+
+/**
+ * @brief Runs the program as a server, which answers the requests of its clients with the output
+ *        of the program options. Returns only if the server fails.
+ * @param options The program options.
+ * @return EXIT_FAILURE, as the server runs until the process is terminated.
+ */
+static int serve(const ProgramOptions& options)
+{
+    int workers = options.workers;
+    if (workers == HARDWARE_WORKERS)
+    {
+        workers = std::max(SINGLE_THREAD, (int) std::thread::hardware_concurrency());
+    }
+    try
+    {
+        HullServer server(options.serveSocket, workers,
+                          [&options](PointSet& pointSet, std::ostream& reply)
+                          {
+                              double errorBound = EXACT_HULL;
+                              PointSet resultSet = calculateHull(pointSet, options, errorBound);
+                              processResult(resultSet, options, errorBound, reply);
+                          });
+        server.run();
+    }
+    catch (const std::runtime_error& error)
+    {
+        std::cerr << error.what() << std::endl;
+    }
+    return EXIT_FAILURE;
+}
+
+
+/*-----=  Window Handling  =-----*/
+
+
+/**
+ * @brief Streams the standard input to a window, and outputs the Convex Hull of the window after
+ *        every interval of Points and at the end of the input.
+ *        The time of a Point is the time it was read.
+ * @param options The program options.
+ */
+static void streamWindow(const ProgramOptions& options)
+{
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+    WindowedHull window;
+    std::string currentInput;
+    int pending = 0;  // The number of Points since the last output.
+    while (std::getline(std::cin, currentInput))
+    {
+        double time = std::chrono::duration<double>(Clock::now() - start).count();
+        window.add(parsePoint(currentInput), time);
+        if (options.windowSize != NO_WINDOW)
+        {
+            window.keepLatest(options.windowSize);
+        }
+        else
+        {
+            window.expireBefore(time - options.windowSeconds);
+        }
+
+        if (++pending == options.interval)
+        {
+            PointSet resultSet = window.hull();
+            processResult(resultSet, options, EXACT_HULL, std::cout);
+            std::cout.flush();
+            pending = 0;
+        }
+    }
+    if (pending > 0)
+    {
+        PointSet resultSet = window.hull();
+        processResult(resultSet, options, EXACT_HULL, std::cout);
+    }
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The Main function that runs this program.
+ *        The function receive input from the user, and then create a PointSet with the given data.
+ *        It then finds the Convex Hull of that PointSet and output the result.
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments, which may hold the output mode.
+ * @return 0 when the program ran successfully, otherwise return a non-zero number.
+ */
+int main(int argc, char *argv[])
+{
+    ProgramOptions options;
+    if (!parseArguments(argc, argv, options))
+    {
+        std::cerr << USAGE_MESSAGE << std::endl;
+        return EXIT_FAILURE;
+    }
+    if ((options.queryFile != nullptr) && !std::ifstream(options.queryFile).is_open())
+    {
+        // Otherwise a missing queries file would silently answer no queries.
+        std::cerr << QUERY_ERROR_MESSAGE << options.queryFile << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (options.serveSocket != nullptr)
+    {
+        return serve(options);
+    }
+    if ((options.windowSize != NO_WINDOW) || (options.windowSeconds != NO_WINDOW))
+    {
+        streamWindow(options);
+        return 0;
+    }
+
+    PointSet resultSet;
+    double errorBound = EXACT_HULL;
+    if (options.pipeline)
+    {
+        // The Points are reduced to the Hull while they are read, so they are never all kept.
+        HullPipeline pipeline(STDIN_FILENO, options.threads);
+        resultSet = pipeline.run();
+    }
+    else if (options.snapshotFile != nullptr)
+    {
+        // The Points of the snapshot are used in place.
+        try
+        {
+            MappedPointSet snapshot(options.snapshotFile);
+            if ((options.saveFile != nullptr) &&
+                !saveInput(snapshot.toPointSet(), options.saveFile))
+            {
+                return EXIT_FAILURE;
+            }
+            if (options.output == LAYERS_OUTPUT)
+            {
+                outputLayers(PointSetView(snapshot.points(), snapshot.size()), std::cout);
+                return 0;
+            }
+            resultSet = calculateHull(snapshot, options, errorBound);
+        }
+        catch (const std::runtime_error& error)
+        {
+            std::cerr << error.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        // Create the PointSet from the user input. Only a regular file can be parsed in parallel.
+        PointSet pointSet;
+        if ((options.threads == SINGLE_THREAD) ||
+            !receiveInputParallel(STDIN_FILENO, options.threads, pointSet))
+        {
+            receiveInput(std::cin, pointSet);
+        }
+        if ((options.saveFile != nullptr) && !saveInput(pointSet, options.saveFile))
+        {
+            return EXIT_FAILURE;
+        }
+        if (options.output == LAYERS_OUTPUT)
+        {
+            outputLayers(pointSet, std::cout);
+            return 0;
+        }
+
+        // Analyze data and get the Convex Hull.
+        resultSet = calculateHull(pointSet, options, errorBound);
+    }
+
+    // Printing the result to the standard output.
+    processResult(resultSet, options, errorBound, std::cout);
+
+    return 0;
 }
\ No newline at end of file
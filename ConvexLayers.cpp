@@ -0,0 +1,250 @@
+/**
+ * @file ConvexLayers.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the Convex Layers of a Set of Points.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the Convex Layers of a Set of Points.
+ * The Points are sorted once by their X and then Y coordinates and cut to blocks of consecutive
+ * Points, which are the leaves of a complete binary tree. Every node of the tree keeps the lower
+ * and the upper chains of the Monotone Chain of the Points which are left under it: a block chains
+ * its own Points, and an inner node runs the Monotone Chain on the chains of its 2 children, as a
+ * Hull vertex of a Set is a vertex of the Hull of any part of it. The chains of the root are the
+ * next layer. After a layer is peeled, only the blocks which lost Points and the nodes above them
+ * calculate their chains again, so a layer takes time in the size of the chains on these paths
+ * instead of O(n) for the Monotone Chain on all the Points which are left.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <numeric>
+#include "ConvexLayers.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def NOT_PEELED 0
+ * @brief A Macro that sets the depth of a Point which is not in any layer yet.
+ */
+#define NOT_PEELED 0
+
+/**
+ * @def LAYER_BLOCK_SIZE 16
+ * @brief A Macro that sets the number of Points in a block, i.e. in a leaf of the tree.
+ */
+#define LAYER_BLOCK_SIZE 16
+
+/**
+ * @def ROOT_NODE 1
+ * @brief A Macro that sets the index of the root in the array of the tree nodes, where the
+ *        children of the node i are 2 * i and 2 * i + 1.
+ */
+#define ROOT_NODE 1
+
+/**
+ * @def TURN_SIZE 2
+ * @brief A Macro that sets the number of chain Points which a new Point turns from.
+ */
+#define TURN_SIZE 2
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The chains of a node of the tree. All the Points are given by their positions in the
+ *        sorted order.
+ */
+struct ChainNode
+{
+    std::vector<int> lower;  // The lower chain of the Points which are left, from left to right.
+    std::vector<int> upper;  // The upper chain of the Points which are left, from right to left.
+};
+
+
+/*-----=  Chain Helpers  =-----*/
+
+
+/**
+ * @brief Pushes a Point to a chain of the Monotone Chain, after popping the chain Points which do
+ *        not make a Counter-Clockwise turn with it.
+ * @param sorted The sorted Points.
+ * @param chain The positions of the chain Points.
+ * @param position The position of the new Point.
+ */
+static void pushToChain(const std::vector<Point>& sorted, std::vector<int>& chain,
+                        int const position)
+{
+    while ((chain.size() >= TURN_SIZE) &&
+           (sorted[chain[chain.size() - 2]].orientation(sorted[chain.back()],
+                                                        sorted[position]) <= 0))
+    {
+        chain.pop_back();
+    }
+    chain.push_back(position);
+}
+
+/**
+ * @brief Calculates the chains of a leaf from the Points which are left in its block.
+ * @param sorted The sorted Points.
+ * @param block The positions of the Points which are left, in sorted order.
+ * @param leaf The leaf.
+ */
+static void chainBlock(const std::vector<Point>& sorted, const std::vector<int>& block,
+                       ChainNode& leaf)
+{
+    leaf.lower.clear();
+    leaf.upper.clear();
+    for (int position : block)
+    {
+        pushToChain(sorted, leaf.lower, position);
+    }
+    for (std::vector<int>::const_reverse_iterator position = block.rbegin();
+         position != block.rend(); ++position)
+    {
+        pushToChain(sorted, leaf.upper, *position);
+    }
+}
+
+/**
+ * @brief Calculates the chains of an inner node from the chains of its children. The Points of
+ *        the left child come before the Points of the right child in the sorted order.
+ * @param sorted The sorted Points.
+ * @param nodes The nodes of the tree.
+ * @param node The index of the inner node.
+ */
+static void chainChildren(const std::vector<Point>& sorted, std::vector<ChainNode>& nodes,
+                          int const node)
+{
+    const ChainNode& leftChild = nodes[2 * node];
+    const ChainNode& rightChild = nodes[2 * node + 1];
+    ChainNode& parent = nodes[node];
+    parent.lower.clear();
+    parent.upper.clear();
+    for (const std::vector<int> *chain : {&leftChild.lower, &rightChild.lower})
+    {
+        for (int position : *chain)
+        {
+            pushToChain(sorted, parent.lower, position);
+        }
+    }
+    for (const std::vector<int> *chain : {&rightChild.upper, &leftChild.upper})
+    {
+        for (int position : *chain)
+        {
+            pushToChain(sorted, parent.upper, position);
+        }
+    }
+}
+
+
+/*-----=  Convex Layers Functions  =-----*/
+
+
+/**
+ * @brief Calculate the Convex Layers of the Points of the given view.
+ *        The Points are sorted once by their X and then Y coordinates, and every layer is peeled
+ *        with the Monotone Chain on a tree of the chains of blocks of the sorted Points, so the
+ *        Points which are left are never sorted again, and only the chains above the Points of a
+ *        layer are calculated again after it is peeled, instead of O(n*log(n)) for every layer.
+ * @param points The view of the distinct Points.
+ * @return The depth of the layer of every Point, in the order of the view, where the Points of
+ *         the Convex Hull are in the layer OUTER_LAYER.
+ */
+std::vector<int> getConvexLayers(PointSetView const points)
+{
+    int count = points.size();
+    std::vector<int> depths(count, NOT_PEELED);
+
+    // Sort the Points once. The view index of every sorted Point maps it back to its depth.
+    std::vector<int> indices(count);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::sort(indices.begin(), indices.end(), [&points](int const index1, int const index2)
+              {
+                  return points[index1].lessByX(points[index2]);
+              });
+    std::vector<Point> sorted(count);
+    for (int i = 0; i < count; i++)
+    {
+        sorted[i] = points[indices[i]];
+    }
+
+    // Cut the sorted Points to blocks, and build the tree of their chains from the leaves up.
+    int leaves = ROOT_NODE;
+    while (leaves * LAYER_BLOCK_SIZE < count)
+    {
+        leaves *= 2;
+    }
+    std::vector<std::vector<int>> blocks(leaves);
+    for (int i = 0; i < count; i++)
+    {
+        blocks[i / LAYER_BLOCK_SIZE].push_back(i);
+    }
+    std::vector<ChainNode> nodes(2 * leaves);
+    for (int block = 0; block < leaves; block++)
+    {
+        chainBlock(sorted, blocks[block], nodes[leaves + block]);
+    }
+    for (int node = leaves - 1; node >= ROOT_NODE; node--)
+    {
+        chainChildren(sorted, nodes, node);
+    }
+
+    std::vector<int> changed;
+    int left = count;
+    for (int depth = OUTER_LAYER; left > 0; depth++)
+    {
+        // Peel the layer. The leftmost and the rightmost Points are on both chains of the root.
+        changed.clear();
+        for (const std::vector<int> *chain : {&nodes[ROOT_NODE].lower, &nodes[ROOT_NODE].upper})
+        {
+            for (int position : *chain)
+            {
+                if (depths[indices[position]] == NOT_PEELED)
+                {
+                    depths[indices[position]] = depth;
+                    left--;
+                    changed.push_back(position / LAYER_BLOCK_SIZE);
+                }
+            }
+        }
+
+        // Only the blocks which lost Points and the nodes above them calculate their chains again.
+        std::sort(changed.begin(), changed.end());
+        changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+        for (int& block : changed)
+        {
+            blocks[block].erase(std::remove_if(blocks[block].begin(), blocks[block].end(),
+                                               [&depths, &indices](int const position)
+                                               {
+                                                   return depths[indices[position]] != NOT_PEELED;
+                                               }), blocks[block].end());
+            chainBlock(sorted, blocks[block], nodes[leaves + block]);
+            block += leaves;
+        }
+        while (changed.front() > ROOT_NODE)
+        {
+            for (int& node : changed)
+            {
+                node /= 2;
+            }
+            changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+            for (int node : changed)
+            {
+                chainChildren(sorted, nodes, node);
+            }
+        }
+    }
+    return depths;
+}
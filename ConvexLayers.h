@@ -0,0 +1,58 @@
+/**
+ * @file ConvexLayers.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the Convex Layers of a Set of Points.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Convex Layers of a Set of Points.
+ * The Convex Layers (the onion peeling) of a Set are found by repeatedly removing the Convex Hull
+ * Points: the first layer is the Convex Hull of the Set, the second layer is the Convex Hull of the
+ * rest of the Points, and so on until no Points are left. As in the Convex Hull calculation, a
+ * Point in the middle of a Hull edge is not a Hull Point, so it belongs to a deeper layer.
+ */
+
+
+#ifndef EX1_CONVEXLAYERS_H
+#define EX1_CONVEXLAYERS_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include "PointSetView.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def OUTER_LAYER 1
+ * @brief A Macro that sets the depth of the outermost layer, i.e. of the Convex Hull.
+ */
+#define OUTER_LAYER 1
+
+
+/*-----=  Convex Layers Functions  =-----*/
+
+
+/**
+ * @brief Calculate the Convex Layers of the Points of the given view.
+ *        The Points are sorted once by their X and then Y coordinates, and every layer is peeled
+ *        with the Monotone Chain on a tree of the chains of blocks of the sorted Points, so the
+ *        Points which are left are never sorted again, and only the chains above the Points of a
+ *        layer are calculated again after it is peeled, instead of O(n*log(n)) for every layer.
+ * @param points The view of the distinct Points.
+ * @return The depth of the layer of every Point, in the order of the view, where the Points of
+ *         the Convex Hull are in the layer OUTER_LAYER.
+ */
+std::vector<int> getConvexLayers(PointSetView const points);
+
+
+#endif //EX1_CONVEXLAYERS_H
@@ -0,0 +1,286 @@
+/**
+ * @file Coordinate.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the Coordinate type and its arithmetic kernels.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Coordinate type and its arithmetic kernels.
+ * The Coordinate type of the Point is selected at compile time by one of the flags
+ * COORDINATE_INT16, COORDINATE_INT32 (the default), COORDINATE_INT64 or COORDINATE_DOUBLE.
+ * For each type, CoordinateTraits selects the types which hold a difference of 2 coordinates and
+ * a product of 2 differences without overflow, so the orientation test is exact:
+ *     int16   Differences in 32 bits and products in 64 bits.
+ *     int32   Differences in 64 bits and products in 128 bits.
+ *     int64   Differences and products in 128 bits, so a coordinate must be below 2^62 in
+ *             magnitude, and parseCoordinate() rejects any larger one.
+ *     double  Regular floating point arithmetic, and parseCoordinate() rejects NaN and infinity.
+ * The integral types also specialise the lexicographic comparison to a single comparison of a
+ * packed key.
+ */
+
+
+#ifndef EX1_COORDINATE_H
+#define EX1_COORDINATE_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def INT64_COORDINATE_LIMIT (1LL << 62)
+ * @brief A Macro that sets the bound of the magnitude of a 64 bits coordinate, below which the
+ *        products of the differences fit in 128 bits.
+ */
+#define INT64_COORDINATE_LIMIT (1LL << 62)
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+#if defined(COORDINATE_INT16)
+/**
+ * @brief Coordinate is the type of a single coordinate of a Point.
+ */
+typedef int16_t Coordinate;
+#elif defined(COORDINATE_INT64)
+typedef int64_t Coordinate;
+#elif defined(COORDINATE_DOUBLE)
+typedef double Coordinate;
+#else
+typedef int32_t Coordinate;
+#endif
+
+/**
+ * @brief WideInteger is a 128 bits integer, for exact products of 64 bits differences.
+ */
+__extension__ typedef __int128 WideInteger;
+
+
+/*-----=  Coordinate Traits  =-----*/
+
+
+/**
+ * @brief The arithmetic traits of a coordinate type. Each supported type specialises it.
+ */
+template <typename T>
+struct CoordinateTraits;
+
+/**
+ * @brief The arithmetic traits of 16 bits coordinates.
+ */
+template <>
+struct CoordinateTraits<int16_t>
+{
+    typedef int32_t Difference;  // Holds a difference of 2 coordinates.
+    typedef int64_t Product;  // Holds a sum of products of 2 differences.
+
+    /**
+     * @brief Compares 2 Points lexicographically by a single packed key.
+     * @return true if (x1, y1) is smaller than (x2, y2).
+     */
+    static bool lexicographicLess(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+    {
+        return (((uint32_t) (uint16_t) (x1 ^ INT16_MIN) << 16) | (uint16_t) (y1 ^ INT16_MIN)) <
+               (((uint32_t) (uint16_t) (x2 ^ INT16_MIN) << 16) | (uint16_t) (y2 ^ INT16_MIN));
+    }
+};
+
+/**
+ * @brief The arithmetic traits of 32 bits coordinates.
+ */
+template <>
+struct CoordinateTraits<int32_t>
+{
+    typedef int64_t Difference;  // Holds a difference of 2 coordinates.
+    typedef WideInteger Product;  // Holds a sum of products of 2 differences.
+
+    /**
+     * @brief Compares 2 Points lexicographically by a single packed key.
+     * @return true if (x1, y1) is smaller than (x2, y2).
+     */
+    static bool lexicographicLess(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+    {
+        return (((uint64_t) ((uint32_t) x1 ^ 0x80000000u) << 32) | ((uint32_t) y1 ^ 0x80000000u)) <
+               (((uint64_t) ((uint32_t) x2 ^ 0x80000000u) << 32) | ((uint32_t) y2 ^ 0x80000000u));
+    }
+};
+
+/**
+ * @brief The arithmetic traits of 64 bits coordinates.
+ */
+template <>
+struct CoordinateTraits<int64_t>
+{
+    typedef WideInteger Difference;  // Holds a difference of 2 coordinates.
+    typedef WideInteger Product;  // Holds a sum of products of 2 differences (|coordinate| < 2^62).
+
+    /**
+     * @brief Compares 2 Points lexicographically.
+     * @return true if (x1, y1) is smaller than (x2, y2).
+     */
+    static bool lexicographicLess(int64_t x1, int64_t y1, int64_t x2, int64_t y2)
+    {
+        return (x1 < x2) || ((x1 == x2) && (y1 < y2));
+    }
+};
+
+/**
+ * @brief The arithmetic traits of floating point coordinates.
+ */
+template <>
+struct CoordinateTraits<double>
+{
+    typedef double Difference;  // Holds a difference of 2 coordinates.
+    typedef double Product;  // Holds a sum of products of 2 differences.
+
+    /**
+     * @brief Compares 2 Points lexicographically.
+     * @return true if (x1, y1) is smaller than (x2, y2).
+     */
+    static bool lexicographicLess(double x1, double y1, double x2, double y2)
+    {
+        return (x1 < x2) || ((x1 == x2) && (y1 < y2));
+    }
+};
+
+/**
+ * @brief CoordinateDifference holds a difference of 2 coordinates without overflow.
+ */
+typedef CoordinateTraits<Coordinate>::Difference CoordinateDifference;
+
+/**
+ * @brief CoordinateProduct holds a cross or a dot product of 2 differences without overflow.
+ */
+typedef CoordinateTraits<Coordinate>::Product CoordinateProduct;
+
+
+/*-----=  Coordinate Kernels  =-----*/
+
+
+/**
+ * @brief Calculates the exact cross product of the vectors (B - A) and (C - A).
+ * @return Positive for a Counter-Clockwise turn A->B->C, negative for a Clockwise turn and zero
+ *         if the Points are collinear.
+ */
+template <typename T>
+inline typename CoordinateTraits<T>::Product crossProduct(T const ax, T const ay, T const bx,
+                                                          T const by, T const cx, T const cy)
+{
+    typedef typename CoordinateTraits<T>::Difference Difference;
+    typedef typename CoordinateTraits<T>::Product Product;
+    return (Product) ((Difference) bx - ax) * ((Difference) cy - ay)
+           - (Product) ((Difference) by - ay) * ((Difference) cx - ax);
+}
+
+/**
+ * @brief Calculates the exact squared distance between (A) and (B).
+ * @return The squared distance.
+ */
+template <typename T>
+inline typename CoordinateTraits<T>::Product squaredDistance(T const ax, T const ay, T const bx,
+                                                             T const by)
+{
+    typedef typename CoordinateTraits<T>::Difference Difference;
+    typedef typename CoordinateTraits<T>::Product Product;
+    Difference deltaX = (Difference) bx - ax;
+    Difference deltaY = (Difference) by - ay;
+    return (Product) deltaX * deltaX + (Product) deltaY * deltaY;
+}
+
+/**
+ * @brief Returns the bits of a coordinate as an unsigned 64 bits value, such that equal
+ *        coordinates have equal bits (for floating point, -0 and +0 are equal).
+ * @param coordinate The coordinate.
+ * @return The bits of the coordinate.
+ */
+inline uint64_t coordinateBits(Coordinate const coordinate)
+{
+#if defined(COORDINATE_DOUBLE)
+    double normalized = coordinate + 0.0;
+    uint64_t bits = 0;
+    memcpy(&bits, &normalized, sizeof(bits));
+    return bits;
+#else
+    return (uint64_t) (int64_t) coordinate;
+#endif
+}
+
+/**
+ * @brief Returns the 32 high bits of a coordinate as an unsigned value which is ordered like the
+ *        coordinates, i.e. a smaller coordinate never has larger bits.
+ * @param coordinate The coordinate.
+ * @return The ordered bits of the coordinate.
+ */
+inline uint32_t coordinateOrderBits(Coordinate const coordinate)
+{
+#if defined(COORDINATE_DOUBLE) || defined(COORDINATE_INT64)
+    // The high bits of a 64 bits integer would hardly change for small values, so it keeps the
+    // high bits of its double value instead, which have the same relative precision everywhere.
+    // The bits of a negative value are reversed, and the positive values are moved above them.
+    double value = (double) coordinate + 0.0;
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    bits = (bits >> 63) ? ~bits : (bits | (1ULL << 63));
+    return (uint32_t) (bits >> 32);
+#else
+    // The bias makes the value unsigned, and the shift aligns its bits to the top.
+    uint64_t biased = (uint64_t) (int64_t) coordinate -
+                      (uint64_t) (int64_t) std::numeric_limits<Coordinate>::min();
+    return (uint32_t) ((biased << (64 - 8 * sizeof(Coordinate))) >> 32);
+#endif
+}
+
+/**
+ * @brief Parse a single coordinate from a given string.
+ *        Throws std::out_of_range if the value does not fit in the Coordinate type, for 64 bits
+ *        coordinates if its magnitude is not below INT64_COORDINATE_LIMIT, and for double
+ *        coordinates if it is not finite (NaN or infinity), and
+ *        std::invalid_argument if the string is not a number (as std::stoi does).
+ * @param input The string to parse.
+ * @return The parsed coordinate.
+ */
+inline Coordinate parseCoordinate(const std::string& input)
+{
+#if defined(COORDINATE_DOUBLE)
+    // NaN is not equal to itself and infinities have no exact differences, so both are rejected.
+    double value = std::stod(input);
+    if (!std::isfinite(value))
+    {
+        throw std::out_of_range(input);
+    }
+    return value;
+#else
+    long long value = std::stoll(input);
+#if defined(COORDINATE_INT64)
+    // A larger coordinate would overflow the exact products of the kernels.
+    if ((value <= -INT64_COORDINATE_LIMIT) || (value >= INT64_COORDINATE_LIMIT))
+#else
+    if ((value < std::numeric_limits<Coordinate>::min()) ||
+        (value > std::numeric_limits<Coordinate>::max()))
+#endif
+    {
+        throw std::out_of_range(input);
+    }
+    return (Coordinate) value;
+#endif
+}
+
+
+#endif //EX1_COORDINATE_H
@@ -0,0 +1,691 @@
+/**
+ * @file ExternalPointSet.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the ExternalPointSet Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the ExternalPointSet Class implementation.
+ * Define the ExternalPointSet Class methods and fields.
+ * Every run is read through a buffer of EXTERNAL_BUFFER_SIZE bytes with pread(), so a sorted
+ * snapshot may serve as a run of many Sets at once. The runs of a Set are merged with a heap of
+ * their current Points, which also drops the Points that appear in more than one run, and the
+ * 2 merged streams are combined in a single pass by the Set operation.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ExternalPointSet.h"
+#include "PointSetInput.h"
+#include "PointSetSnapshot.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def BUFFER_POINTS (EXTERNAL_BUFFER_SIZE / sizeof(Point))
+ * @brief A Macro that sets the number of Points in the buffer of a run.
+ */
+#define BUFFER_POINTS (EXTERNAL_BUFFER_SIZE / sizeof(Point))
+
+/**
+ * @def RUN_FILE_NAME "/pointset-run-XXXXXX"
+ * @brief A Macro that sets the name template of a temporary run file.
+ */
+#define RUN_FILE_NAME "/pointset-run-XXXXXX"
+
+/**
+ * @def SNAPSHOT_FILE_MODE 0644
+ * @brief A Macro that sets the permissions of a new snapshot file.
+ */
+#define SNAPSHOT_FILE_MODE 0644
+
+/**
+ * @def FIRST_LINE 1
+ * @brief A Macro that sets the number of the first line of a text input.
+ */
+#define FIRST_LINE 1
+
+/**
+ * @def OUTPUT_FILE_SUFFIX ".XXXXXX"
+ * @brief A Macro that sets the suffix of the name template of the temporary output file, which
+ *        replaces the snapshot file only when it is complete.
+ */
+#define OUTPUT_FILE_SUFFIX ".XXXXXX"
+
+/**
+ * @def NO_FILE -1
+ * @brief A Macro that sets the value of a file which is not open.
+ */
+#define NO_FILE -1
+
+
+/*-----=  File Helpers  =-----*/
+
+
+/**
+ * @brief Reads exactly the given number of bytes from a given offset of a file.
+ *        Throws std::runtime_error if the file ends before or can not be read.
+ * @param file The file to read.
+ * @param data The memory to read to.
+ * @param bytes The number of bytes.
+ * @param offset The offset in the file.
+ */
+static void readFully(int const file, void *data, size_t bytes, off_t offset)
+{
+    char *position = (char *) data;
+    while (bytes > 0)
+    {
+        ssize_t count = pread(file, position, bytes, offset);
+        if ((count < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            throw std::runtime_error("Can not read a Point file");
+        }
+        position += count;
+        bytes -= (size_t) count;
+        offset += count;
+    }
+}
+
+/**
+ * @brief Writes exactly the given number of bytes to the current offset of a file.
+ *        Throws std::runtime_error if the file can not be written (e.g. the disk is full).
+ * @param file The file to write.
+ * @param data The bytes to write.
+ * @param bytes The number of bytes.
+ */
+static void writeFully(int const file, const void *data, size_t bytes)
+{
+    const char *position = (const char *) data;
+    while (bytes > 0)
+    {
+        ssize_t count = write(file, position, bytes);
+        if ((count < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            throw std::runtime_error("Can not write a Point file");
+        }
+        position += count;
+        bytes -= (size_t) count;
+    }
+}
+
+
+/*-----=  Run Streams  =-----*/
+
+
+/**
+ * @brief A reader of the Points of a run, one buffer at a time. The buffer is allocated on the
+ *        first read and released when the run ends.
+ */
+class RunReader
+{
+public:
+
+    /**
+     * @brief A Constructor for the RunReader of a given run.
+     * @param file The file of the run.
+     * @param start The offset of the first Point in the file.
+     * @param count The number of Points.
+     */
+    RunReader(int const file, off_t const start, uint64_t const count)
+            : _file(file), _offset(start), _remaining(count), _position(0)
+    {
+
+    }
+
+    /**
+     * @brief Reads the next Point of the run.
+     * @param point The Point to set.
+     * @return true if a Point was read, false if the run ended.
+     */
+    bool next(Point& point)
+    {
+        if ((_position == _buffer.size()) && !_fill())
+        {
+            return false;
+        }
+        point = _buffer[_position++];
+        return true;
+    }
+
+private:
+    int _file;  // The file of the run.
+    off_t _offset;  // The offset of the next Point which was not read to the buffer.
+    uint64_t _remaining;  // The number of Points which were not read to the buffer.
+    std::vector<Point> _buffer;  // The read Points.
+    size_t _position;  // The index of the next Point in the buffer.
+
+    /**
+     * @brief Reads the next Points of the run to the buffer.
+     * @return true if Points were read, false if the run ended.
+     */
+    bool _fill()
+    {
+        if (_remaining == 0)
+        {
+            std::vector<Point>().swap(_buffer);
+            _position = 0;
+            return false;
+        }
+        size_t count = (size_t) std::min(_remaining, (uint64_t) BUFFER_POINTS);
+        _buffer.resize(count);
+        readFully(_file, _buffer.data(), count * sizeof(Point), _offset);
+        _offset += (off_t) (count * sizeof(Point));
+        _remaining -= count;
+        _position = 0;
+        return true;
+    }
+};
+
+/**
+ * @brief A stream of the distinct Points of several runs, sorted by their X and then Y
+ *        coordinates.
+ */
+class RunMerger
+{
+public:
+
+    /**
+     * @brief A Constructor for the RunMerger of the given runs.
+     * @param readers The readers of the runs.
+     */
+    explicit RunMerger(std::vector<RunReader>&& readers) : _readers(std::move(readers)),
+                                                            _started(false)
+    {
+        for (size_t reader = 0; reader < _readers.size(); reader++)
+        {
+            _advance(reader);
+        }
+    }
+
+    /**
+     * @brief Returns the next Point, which is larger than all the previous Points.
+     * @param point The Point to set.
+     * @return true if a Point was returned, false if all the runs ended.
+     */
+    bool next(Point& point)
+    {
+        while (!_heap.empty())
+        {
+            HeapEntry entry = _heap.top();
+            _heap.pop();
+            _advance(entry.reader);
+            if (!_started || !(entry.point == _last))
+            {
+                _started = true;
+                _last = entry.point;
+                point = entry.point;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+
+    /**
+     * @brief The current Point of a run in the heap.
+     */
+    struct HeapEntry
+    {
+        Point point;  // The current Point.
+        size_t reader;  // The index of the reader of the run.
+
+        /**
+         * @brief Compares the entries by their Points, used for ordering the heap from the
+         *        smallest Point.
+         * @param other The entry to compare to.
+         * @return true if the Point of this entry is larger.
+         */
+        bool operator>(const HeapEntry& other) const { return other.point.lessByX(point); };
+    };
+
+    std::vector<RunReader> _readers;  // The readers of the runs.
+    // The current Point of every run which did not end.
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> _heap;
+    bool _started;  // true if a Point was already returned.
+    Point _last;  // The last returned Point.
+
+    /**
+     * @brief Pushes the next Point of a run to the heap, unless the run ended.
+     * @param reader The index of the reader of the run.
+     */
+    void _advance(size_t const reader)
+    {
+        HeapEntry entry;
+        entry.reader = reader;
+        if (_readers[reader].next(entry.point))
+        {
+            _heap.push(entry);
+        }
+    }
+};
+
+/**
+ * @brief A writer of Points to the current offset of a file, one buffer at a time.
+ */
+class RunWriter
+{
+public:
+
+    /**
+     * @brief A Constructor for the RunWriter of a given file.
+     * @param file The file to write.
+     */
+    explicit RunWriter(int const file) : _file(file), _count(0)
+    {
+        _buffer.reserve(BUFFER_POINTS);
+    }
+
+    /**
+     * @brief Writes a Point.
+     * @param point The Point to write.
+     */
+    void write(const Point& point)
+    {
+        _buffer.push_back(point);
+        _count++;
+        if (_buffer.size() == BUFFER_POINTS)
+        {
+            flush();
+        }
+    }
+
+    /**
+     * @brief Writes the Points which are still in the buffer.
+     */
+    void flush()
+    {
+        writeFully(_file, _buffer.data(), _buffer.size() * sizeof(Point));
+        _buffer.clear();
+    }
+
+    /**
+     * @brief Returns the number of Points which were written.
+     * @return The number of Points.
+     */
+    uint64_t count() const { return _count; };
+
+private:
+    int _file;  // The file to write.
+    std::vector<Point> _buffer;  // The Points which were not written to the file yet.
+    uint64_t _count;  // The number of written Points.
+};
+
+
+/*-----=  ExternalPointSet Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for an empty ExternalPointSet.
+ * @param memory The memory budget in bytes, at least MINIMAL_EXTERNAL_MEMORY.
+ * @param directory The directory of the temporary run files.
+ */
+ExternalPointSet::ExternalPointSet(size_t const memory, const std::string& directory)
+        : _memory(std::max(memory, (size_t) MINIMAL_EXTERNAL_MEMORY)), _directory(directory)
+{
+
+}
+
+/**
+ * @brief A Destructor for the ExternalPointSet, which closes its run files.
+ */
+ExternalPointSet::~ExternalPointSet()
+{
+    for (const Run& run : _runs)
+    {
+        close(run.file);
+    }
+}
+
+
+/*-----=  ExternalPointSet Methods  =-----*/
+
+
+/**
+ * @brief Add a given Point to the ExternalPointSet. A Point which is already in the Set is
+ *        dropped when the runs are merged.
+ * @param point The Point to add.
+ */
+void ExternalPointSet::add(const Point& point)
+{
+    if (_buffer.capacity() < _capacity())
+    {
+        // The whole buffer is reserved at once, so it never holds 2 copies while it grows.
+        _buffer.reserve(_capacity());
+    }
+    _buffer.push_back(point);
+    if (_buffer.size() == _capacity())
+    {
+        _spill();
+    }
+}
+
+/**
+ * @brief Add the Points of a snapshot file to the ExternalPointSet. A sorted snapshot is used
+ *        as a run in place, and the Points of another snapshot are read straight to the buffer.
+ * @param path The path of the snapshot file.
+ */
+void ExternalPointSet::addSnapshot(const std::string& path)
+{
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        throw std::runtime_error("Can not open the snapshot " + path);
+    }
+    SnapshotHeader header;
+    struct stat status;
+    try
+    {
+        readFully(file, &header, sizeof(header), 0);
+    }
+    catch (const std::runtime_error&)
+    {
+        close(file);
+        throw std::runtime_error("Invalid snapshot " + path);
+    }
+    if (!isValidSnapshotHeader(header) || (fstat(file, &status) != 0) ||
+        ((uint64_t) status.st_size != sizeof(header) + header.count * sizeof(Point)))
+    {
+        close(file);
+        throw std::runtime_error("Invalid snapshot " + path);
+    }
+
+    if ((header.flags & SORTED_SNAPSHOT) && (header.count > 0))
+    {
+        _runs.push_back(Run{file, (off_t) sizeof(header), header.count});
+        return;
+    }
+    off_t offset = sizeof(header);
+    uint64_t remaining = header.count;
+    try
+    {
+        while (remaining > 0)
+        {
+            if (_buffer.capacity() < _capacity())
+            {
+                _buffer.reserve(_capacity());
+            }
+            size_t size = _buffer.size();
+            size_t count = (size_t) std::min(remaining, (uint64_t) (_capacity() - size));
+            _buffer.resize(size + count);
+            readFully(file, _buffer.data() + size, count * sizeof(Point), offset);
+            offset += (off_t) (count * sizeof(Point));
+            remaining -= count;
+            if (_buffer.size() == _capacity())
+            {
+                _spill();
+            }
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        close(file);
+        throw;
+    }
+    close(file);
+}
+
+/**
+ * @brief Add the Points of the "X,Y" lines of a given input to the ExternalPointSet.
+ *        Throws std::invalid_argument with the number and the text of the first line which
+ *        is not a valid Point.
+ * @param input The input stream.
+ */
+void ExternalPointSet::addLines(std::istream& input)
+{
+    std::string currentInput;
+    for (uint64_t line = FIRST_LINE; std::getline(input, currentInput); line++)
+    {
+        Point point;
+        try
+        {
+            point = parsePoint(currentInput);
+        }
+        catch (const std::exception&)
+        {
+            throw std::invalid_argument("Invalid input line " + std::to_string(line) + ": " +
+                                        currentInput);
+        }
+        add(point);
+    }
+}
+
+/**
+ * @brief Spills the Points in the buffer to a run and releases the buffer, so another Set may
+ *        be filled within the same memory budget. Points may still be added afterwards.
+ */
+void ExternalPointSet::seal()
+{
+    _spill();
+    std::vector<Point>().swap(_buffer);
+}
+
+/**
+ * @brief Writes the result of a Set operation of this ExternalPointSet and another one to a
+ *        sorted snapshot file, within the memory budget of this ExternalPointSet.
+ *        Both Sets are sealed first.
+ * @param other The second Set of the operation.
+ * @param operation The Set operation.
+ * @param path The path of the snapshot file.
+ * @return The number of Points which were written.
+ */
+uint64_t ExternalPointSet::writeOperation(ExternalPointSet& other,
+                                          ExternalOperation const operation,
+                                          const std::string& path)
+{
+    seal();
+    other.seal();
+
+    // Each Set gets half of the run buffers, and the output gets the last one.
+    size_t fanIn = _fanIn();
+    size_t maximalRuns = std::max(fanIn / 2, (size_t) 1);
+    _compact(maximalRuns, fanIn);
+    other._compact(maximalRuns, fanIn);
+
+    std::vector<RunReader> readers;
+    for (const Run& run : _runs)
+    {
+        readers.emplace_back(run.file, run.start, run.count);
+    }
+    RunMerger first(std::move(readers));
+    readers.clear();
+    for (const Run& run : other._runs)
+    {
+        readers.emplace_back(run.file, run.start, run.count);
+    }
+    RunMerger second(std::move(readers));
+
+    // The output may be one of the inputs, which is still read in place as a run, so it is
+    // written to a temporary file next to it and renamed over it only when it is complete.
+    std::string name = path + OUTPUT_FILE_SUFFIX;
+    std::vector<char> outputPath(name.begin(), name.end());
+    outputPath.push_back('\0');
+    int file = mkstemp(outputPath.data());
+    if (file == NO_FILE)
+    {
+        throw std::runtime_error("Can not create the snapshot " + path);
+    }
+    uint64_t count = 0;
+    try
+    {
+        // The header is written again with the number of Points when they are all written.
+        SnapshotHeader header = createSnapshotHeader(0, SORTED_SNAPSHOT);
+        writeFully(file, &header, sizeof(header));
+        RunWriter writer(file);
+        Point firstPoint;
+        Point secondPoint;
+        bool hasFirst = first.next(firstPoint);
+        bool hasSecond = second.next(secondPoint);
+        while (hasFirst || ((operation == EXTERNAL_UNION) && hasSecond))
+        {
+            if ((operation == EXTERNAL_INTERSECTION) && !hasSecond)
+            {
+                break;
+            }
+            if (hasFirst && (!hasSecond || firstPoint.lessByX(secondPoint)))
+            {
+                if (operation != EXTERNAL_INTERSECTION)
+                {
+                    writer.write(firstPoint);
+                }
+                hasFirst = first.next(firstPoint);
+            }
+            else if (!hasFirst || secondPoint.lessByX(firstPoint))
+            {
+                if (operation == EXTERNAL_UNION)
+                {
+                    writer.write(secondPoint);
+                }
+                hasSecond = second.next(secondPoint);
+            }
+            else
+            {
+                if (operation != EXTERNAL_DIFFERENCE)
+                {
+                    writer.write(firstPoint);
+                }
+                hasFirst = first.next(firstPoint);
+                hasSecond = second.next(secondPoint);
+            }
+        }
+        writer.flush();
+        count = writer.count();
+
+        header.count = count;
+        if ((pwrite(file, &header, sizeof(header), 0) != (ssize_t) sizeof(header)) ||
+            (fchmod(file, SNAPSHOT_FILE_MODE) != 0))
+        {
+            throw std::runtime_error("Can not write the snapshot " + path);
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        close(file);
+        unlink(outputPath.data());
+        throw;
+    }
+    if ((close(file) != 0) || (rename(outputPath.data(), path.c_str()) != 0))
+    {
+        unlink(outputPath.data());
+        throw std::runtime_error("Can not write the snapshot " + path);
+    }
+    return count;
+}
+
+/**
+ * @brief Sorts the Points in the buffer, drops their repetitions and writes them to a new run.
+ */
+void ExternalPointSet::_spill()
+{
+    if (_buffer.empty())
+    {
+        return;
+    }
+    std::sort(_buffer.begin(), _buffer.end(), [](const Point& point1, const Point& point2)
+              {
+                  return point1.lessByX(point2);
+              });
+    _buffer.erase(std::unique(_buffer.begin(), _buffer.end()), _buffer.end());
+
+    int file = _createRunFile();
+    try
+    {
+        writeFully(file, _buffer.data(), _buffer.size() * sizeof(Point));
+    }
+    catch (const std::runtime_error&)
+    {
+        close(file);
+        throw;
+    }
+    _runs.push_back(Run{file, 0, (uint64_t) _buffer.size()});
+    _buffer.clear();
+}
+
+/**
+ * @brief Merges groups of runs to longer runs until there are at most the given number of runs.
+ * @param maximalRuns The maximal number of runs, at least 1.
+ * @param fanIn The maximal number of runs which are merged at once, at least 2.
+ */
+void ExternalPointSet::_compact(size_t const maximalRuns, size_t const fanIn)
+{
+    while (_runs.size() > maximalRuns)
+    {
+        // The oldest runs are merged first, so every run is merged about the same times.
+        size_t group = std::min(fanIn, _runs.size() - maximalRuns + 1);
+        std::vector<RunReader> readers;
+        for (size_t run = 0; run < group; run++)
+        {
+            readers.emplace_back(_runs[run].file, _runs[run].start, _runs[run].count);
+        }
+        RunMerger merger(std::move(readers));
+
+        int file = _createRunFile();
+        RunWriter writer(file);
+        try
+        {
+            Point point;
+            while (merger.next(point))
+            {
+                writer.write(point);
+            }
+            writer.flush();
+        }
+        catch (const std::runtime_error&)
+        {
+            close(file);
+            throw;
+        }
+
+        for (size_t run = 0; run < group; run++)
+        {
+            close(_runs[run].file);
+        }
+        _runs.erase(_runs.begin(), _runs.begin() + group);
+        _runs.push_back(Run{file, 0, writer.count()});
+    }
+}
+
+/**
+ * @brief Creates a temporary file for a run, which is removed from the directory at once.
+ * @return The open file.
+ */
+int ExternalPointSet::_createRunFile() const
+{
+    std::string name = _directory + RUN_FILE_NAME;
+    std::vector<char> path(name.begin(), name.end());
+    path.push_back('\0');
+    int file = mkstemp(path.data());
+    if (file == NO_FILE)
+    {
+        throw std::runtime_error("Can not create a run file in " + _directory);
+    }
+    unlink(path.data());
+    return file;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file ExternalPointSet.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the ExternalPointSet Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the ExternalPointSet Class.
+ * Declaring the ExternalPointSet Class, it's methods and fields.
+ * An ExternalPointSet is a Set of Points which may be larger than the memory: the Points are
+ * collected in a buffer of a given memory budget, and every full buffer is sorted and spilled to a
+ * temporary file as a sorted run. The union, intersection and difference of 2 ExternalPointSets
+ * merge their runs and stream the result to a sorted snapshot file, so no Set is ever loaded
+ * whole. A sorted snapshot (e.g. from 'ConvexHull --save') is already a run, and it is merged in
+ * place without being copied.
+ */
+
+
+#ifndef EX1_EXTERNALPOINTSET_H
+#define EX1_EXTERNALPOINTSET_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+#include "Point.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def EXTERNAL_BUFFER_SIZE (1 << 20)
+ * @brief A Macro that sets the number of bytes of the buffer of every run which is merged.
+ */
+#define EXTERNAL_BUFFER_SIZE (1 << 20)
+
+/**
+ * @def MINIMAL_EXTERNAL_MEMORY (4 * EXTERNAL_BUFFER_SIZE)
+ * @brief A Macro that sets the smallest valid memory budget of an ExternalPointSet, which holds
+ *        the buffers of a run of each Set and of the output at once.
+ */
+#define MINIMAL_EXTERNAL_MEMORY (4 * EXTERNAL_BUFFER_SIZE)
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The Set operations of ExternalPointSets.
+ */
+enum ExternalOperation
+{
+    EXTERNAL_UNION,  // The Points which are in any of the Sets.
+    EXTERNAL_INTERSECTION,  // The Points which are in both Sets.
+    EXTERNAL_DIFFERENCE  // The Points which are in the first Set and not in the second.
+};
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a Set of Points which is kept on disk as sorted runs.
+ *        The runs are temporary files which are removed as soon as they are created, so they are
+ *        released when the ExternalPointSet is destroyed or the process ends.
+ *        The memory budget bounds the buffer of the Points which were not spilled yet, and the
+ *        buffers of all the runs which are merged at once. When there are more runs than the
+ *        budget can merge, groups of runs are merged first to longer runs.
+ *        Throws std::runtime_error when a file can not be read or written.
+ */
+class ExternalPointSet
+{
+public:
+
+    /**
+     * @brief A Constructor for an empty ExternalPointSet.
+     * @param memory The memory budget in bytes, at least MINIMAL_EXTERNAL_MEMORY.
+     * @param directory The directory of the temporary run files.
+     */
+    ExternalPointSet(size_t const memory, const std::string& directory);
+
+    /**
+     * @brief The ExternalPointSet owns its run files, so it can not be copied.
+     */
+    ExternalPointSet(const ExternalPointSet& other) = delete;
+
+    /**
+     * @brief The ExternalPointSet owns its run files, so it can not be assigned.
+     */
+    ExternalPointSet& operator=(const ExternalPointSet& other) = delete;
+
+    /**
+     * @brief A Destructor for the ExternalPointSet, which closes its run files.
+     */
+    ~ExternalPointSet();
+
+    /**
+     * @brief Add a given Point to the ExternalPointSet. A Point which is already in the Set is
+     *        dropped when the runs are merged.
+     * @param point The Point to add.
+     */
+    void add(const Point& point);
+
+    /**
+     * @brief Add the Points of a snapshot file to the ExternalPointSet. A sorted snapshot is used
+     *        as a run in place, and the Points of another snapshot are read straight to the buffer.
+     * @param path The path of the snapshot file.
+     */
+    void addSnapshot(const std::string& path);
+
+    /**
+     * @brief Add the Points of the "X,Y" lines of a given input to the ExternalPointSet.
+     *        Throws std::invalid_argument with the number and the text of the first line which
+     *        is not a valid Point.
+     * @param input The input stream.
+     */
+    void addLines(std::istream& input);
+
+    /**
+     * @brief Spills the Points in the buffer to a run and releases the buffer, so another Set may
+     *        be filled within the same memory budget. Points may still be added afterwards.
+     */
+    void seal();
+
+    /**
+     * @brief Writes the result of a Set operation of this ExternalPointSet and another one to a
+     *        sorted snapshot file, within the memory budget of this ExternalPointSet.
+     *        Both Sets are sealed first. The result is written to a temporary file in the same
+     *        directory, which replaces the snapshot file only when it is complete, so the path
+     *        may be one of the input snapshots.
+     * @param other The second Set of the operation.
+     * @param operation The Set operation.
+     * @param path The path of the snapshot file.
+     * @return The number of Points which were written.
+     */
+    uint64_t writeOperation(ExternalPointSet& other, ExternalOperation const operation,
+                            const std::string& path);
+
+private:
+
+    /**
+     * @brief A sorted run of distinct Points in a file.
+     */
+    struct Run
+    {
+        int file;  // The open file of the run.
+        off_t start;  // The offset of the first Point in the file.
+        uint64_t count;  // The number of Points.
+    };
+
+    // ExternalPointSet Private Fields.
+    size_t _memory;  // The memory budget in bytes.
+    std::string _directory;  // The directory of the temporary run files.
+    std::vector<Point> _buffer;  // The Points which were not spilled yet.
+    std::vector<Run> _runs;  // The spilled runs and the sorted snapshots.
+
+    /**
+     * @brief Returns the number of Points which the buffer holds within the memory budget.
+     * @return The capacity of the buffer.
+     */
+    size_t _capacity() const { return _memory / sizeof(Point); };
+
+    /**
+     * @brief Returns the number of runs which may be merged at once within the memory budget,
+     *        with a buffer for each run and one for the output.
+     * @return The number of runs.
+     */
+    size_t _fanIn() const { return _memory / EXTERNAL_BUFFER_SIZE - 1; };
+
+    /**
+     * @brief Sorts the Points in the buffer, drops their repetitions and writes them to a new run.
+     */
+    void _spill();
+
+    /**
+     * @brief Merges groups of runs to longer runs until there are at most the given number of runs.
+     * @param maximalRuns The maximal number of runs, at least 1.
+     * @param fanIn The maximal number of runs which are merged at once, at least 2.
+     */
+    void _compact(size_t const maximalRuns, size_t const fanIn);
+
+    /**
+     * @brief Creates a temporary file for a run, which is removed from the directory at once.
+     * @return The open file.
+     */
+    int _createRunFile() const;
+};
+
+
+#endif //EX1_EXTERNALPOINTSET_H
@@ -0,0 +1,300 @@
+/**
+ * @file ExternalSetOperations.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A program for the Set operations of PointSets which are larger than the memory.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A program for the Set operations of PointSets which are larger than the memory.
+ * Input:       The operation (union, intersect or subtract), the paths of the 2 input Sets and
+ *              the path of the output snapshot. An input is either a snapshot (e.g. from
+ *              'ConvexHull --save') or a file of "X,Y" lines.
+ *              An optional command line argument "--memory=MB" sets the memory budget in MiB
+ *              (256 by default), and "--temp=DIR" sets the directory of the temporary files
+ *              ($TMPDIR or /tmp by default).
+ * Process:     Every input is read to an ExternalPointSet, which spills it to sorted runs in the
+ *              temporary directory, and the runs of both Sets are merged by the operation (see
+ *              'ExternalPointSet.h').
+ * Output:      The result is written as a sorted snapshot, and its number of Points is printed to
+ *              the standard output.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include "ExternalPointSet.h"
+#include "PointSetSnapshot.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def USAGE_MESSAGE
+ * @brief A Macro that sets the usage message of the program.
+ */
+#define USAGE_MESSAGE "Usage: ExternalSetOperations union|intersect|subtract A B OUTPUT " \
+                      "[--memory=MB] [--temp=DIR]"
+
+/**
+ * @def UNION_NAME "union"
+ * @brief A Macro that sets the name of the union operation.
+ */
+#define UNION_NAME "union"
+
+/**
+ * @def INTERSECT_NAME "intersect"
+ * @brief A Macro that sets the name of the intersection operation.
+ */
+#define INTERSECT_NAME "intersect"
+
+/**
+ * @def SUBTRACT_NAME "subtract"
+ * @brief A Macro that sets the name of the difference operation.
+ */
+#define SUBTRACT_NAME "subtract"
+
+/**
+ * @def MEMORY_OPTION "--memory="
+ * @brief A Macro that sets the prefix of the memory budget option.
+ */
+#define MEMORY_OPTION "--memory="
+
+/**
+ * @def TEMP_OPTION "--temp="
+ * @brief A Macro that sets the prefix of the temporary directory option.
+ */
+#define TEMP_OPTION "--temp="
+
+/**
+ * @def DEFAULT_MEMORY 256
+ * @brief A Macro that sets the default memory budget in MiB.
+ */
+#define DEFAULT_MEMORY 256
+
+/**
+ * @def MEBIBYTE (1 << 20)
+ * @brief A Macro that sets the number of bytes in a MiB.
+ */
+#define MEBIBYTE (1 << 20)
+
+/**
+ * @def MAXIMAL_MEMORY (1L << 20)
+ * @brief A Macro that sets the largest memory budget in MiB.
+ */
+#define MAXIMAL_MEMORY (1L << 20)
+
+/**
+ * @def TEMP_VARIABLE "TMPDIR"
+ * @brief A Macro that sets the environment variable of the default temporary directory.
+ */
+#define TEMP_VARIABLE "TMPDIR"
+
+/**
+ * @def DEFAULT_TEMP "/tmp"
+ * @brief A Macro that sets the temporary directory if TEMP_VARIABLE is not set.
+ */
+#define DEFAULT_TEMP "/tmp"
+
+/**
+ * @def DECIMAL_BASE 10
+ * @brief A Macro that sets the base of the numbers in the command line.
+ */
+#define DECIMAL_BASE 10
+
+/**
+ * @def OPERATION_ARGUMENT 1
+ * @brief A Macro that sets the index of the operation argument.
+ */
+#define OPERATION_ARGUMENT 1
+
+/**
+ * @def POSITIONAL_ARGUMENTS 4
+ * @brief A Macro that sets the number of the operation and path arguments.
+ */
+#define POSITIONAL_ARGUMENTS 4
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The options of the program, as given in the command line.
+ */
+struct ProgramOptions
+{
+    ExternalOperation operation;  // The Set operation.
+    const char *inputA;  // The path of the first input.
+    const char *inputB;  // The path of the second input.
+    const char *output;  // The path of the output snapshot.
+    long memory;  // The memory budget in MiB.
+    std::string directory;  // The directory of the temporary files.
+};
+
+
+/*-----=  Arguments Parsing  =-----*/
+
+
+/**
+ * @brief Parse the name of a Set operation.
+ * @param name The name as given in the command line.
+ * @param operation The operation to set.
+ * @return true if the name is valid, false otherwise.
+ */
+static bool parseOperation(const char *name, ExternalOperation& operation)
+{
+    if (strcmp(name, UNION_NAME) == 0)
+    {
+        operation = EXTERNAL_UNION;
+    }
+    else if (strcmp(name, INTERSECT_NAME) == 0)
+    {
+        operation = EXTERNAL_INTERSECTION;
+    }
+    else if (strcmp(name, SUBTRACT_NAME) == 0)
+    {
+        operation = EXTERNAL_DIFFERENCE;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Parse the command line arguments of the program.
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ * @param options The options to fill.
+ * @return true if all the arguments are valid, false otherwise.
+ */
+static bool parseArguments(int const argc, char *argv[], ProgramOptions& options)
+{
+    const char *temp = getenv(TEMP_VARIABLE);
+    options.directory = ((temp != nullptr) && (*temp != '\0')) ? temp : DEFAULT_TEMP;
+    options.memory = DEFAULT_MEMORY;
+    const char *positional[POSITIONAL_ARGUMENTS];
+    int positionals = 0;
+    for (int i = OPERATION_ARGUMENT; i < argc; i++)
+    {
+        if (strncmp(argv[i], MEMORY_OPTION, strlen(MEMORY_OPTION)) == 0)
+        {
+            const char *value = argv[i] + strlen(MEMORY_OPTION);
+            char *end = nullptr;
+            options.memory = strtol(value, &end, DECIMAL_BASE);
+            if ((*value == '\0') || (*end != '\0') ||
+                (options.memory * MEBIBYTE < MINIMAL_EXTERNAL_MEMORY) ||
+                (options.memory > MAXIMAL_MEMORY))
+            {
+                return false;
+            }
+        }
+        else if (strncmp(argv[i], TEMP_OPTION, strlen(TEMP_OPTION)) == 0)
+        {
+            options.directory = argv[i] + strlen(TEMP_OPTION);
+        }
+        else if (positionals < POSITIONAL_ARGUMENTS)
+        {
+            positional[positionals++] = argv[i];
+        }
+        else
+        {
+            return false;
+        }
+    }
+    if (positionals != POSITIONAL_ARGUMENTS)
+    {
+        return false;
+    }
+    options.inputA = positional[1];
+    options.inputB = positional[2];
+    options.output = positional[3];
+    return parseOperation(positional[0], options.operation);
+}
+
+
+/*-----=  Set Operations  =-----*/
+
+
+/**
+ * @brief Adds the Points of an input file to the given ExternalPointSet, and seals it.
+ *        Throws std::runtime_error if the file can not be read, and std::invalid_argument with
+ *        the path and the line if a line of a text input is not a valid Point.
+ * @param path The path of the input, a snapshot or a file of "X,Y" lines.
+ * @param pointSet The ExternalPointSet to fill.
+ */
+static void readInput(const char *path, ExternalPointSet& pointSet)
+{
+    std::ifstream input(path, std::ios::binary);
+    if (!input)
+    {
+        throw std::runtime_error(std::string("Can not open the input ") + path);
+    }
+    char magic[SNAPSHOT_MAGIC_SIZE] = {};
+    input.read(magic, SNAPSHOT_MAGIC_SIZE);
+    if ((input.gcount() == SNAPSHOT_MAGIC_SIZE) &&
+        (memcmp(magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE) == 0))
+    {
+        input.close();
+        pointSet.addSnapshot(path);
+    }
+    else
+    {
+        input.clear();
+        input.seekg(0);
+        try
+        {
+            pointSet.addLines(input);
+        }
+        catch (const std::invalid_argument& error)
+        {
+            throw std::invalid_argument(std::string(path) + ": " + error.what());
+        }
+    }
+    pointSet.seal();
+}
+
+/**
+ * @brief The main function of the program, which runs the Set operation of the 2 inputs.
+ * @return 0 if the result was written, EXIT_FAILURE otherwise.
+ */
+int main(int argc, char *argv[])
+{
+    ProgramOptions options;
+    if (!parseArguments(argc, argv, options))
+    {
+        std::cerr << USAGE_MESSAGE << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Each Set is sealed after it is read, so the budget holds a single buffer at a time.
+    size_t memory = (size_t) options.memory * MEBIBYTE;
+    ExternalPointSet pointSetA(memory, options.directory);
+    ExternalPointSet pointSetB(memory, options.directory);
+    try
+    {
+        readInput(options.inputA, pointSetA);
+        readInput(options.inputB, pointSetB);
+        std::cout << pointSetA.writeOperation(pointSetB, options.operation, options.output)
+                  << std::endl;
+    }
+    catch (const std::exception& error)
+    {
+        // A file which can not be read or written, or an invalid line of a text input.
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,457 @@
+/**
+ * @file FrozenPointSet.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the FrozenPointSet Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the FrozenPointSet Class implementation.
+ * Define the FrozenPointSet Class methods and fields.
+ * The key of an integral coordinate is the coordinate minus the minimal coordinate, and the key of
+ * a floating point coordinate is its bits, reversed for a negative value and with the sign bit set
+ * for a positive value. Both have the same order as the coordinates and are decoded exactly.
+ * The Points of both Sets of an operation are in the same order, so the operations merge them in a
+ * single pass, and their result is encoded as it is found.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include "FrozenPointSet.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def EMPTY_SET_SIZE 0
+ * @brief A Macro that sets the size for an empty FrozenPointSet.
+ */
+#define EMPTY_SET_SIZE 0
+
+/**
+ * @def VARINT_PAYLOAD_BITS 7
+ * @brief A Macro that sets the number of bits of a value in every byte of a variable length
+ *        integer.
+ */
+#define VARINT_PAYLOAD_BITS 7
+
+/**
+ * @def VARINT_PAYLOAD_MASK 0x7F
+ * @brief A Macro that sets the mask of the value bits in a byte of a variable length integer.
+ */
+#define VARINT_PAYLOAD_MASK 0x7F
+
+/**
+ * @def VARINT_CONTINUE 0x80
+ * @brief A Macro that sets the bit which marks a byte of a variable length integer which is not
+ *        the last one.
+ */
+#define VARINT_CONTINUE 0x80
+
+/**
+ * @def KEY_SIGN_BIT (1ULL << 63)
+ * @brief A Macro that sets the sign bit of a floating point coordinate.
+ */
+#define KEY_SIGN_BIT (1ULL << 63)
+
+
+/*-----=  Encoding Helpers  =-----*/
+
+
+/**
+ * @brief Maps a coordinate to an unsigned key with the same order.
+ * @param coordinate The coordinate.
+ * @return The key of the coordinate.
+ */
+static uint64_t coordinateKey(Coordinate const coordinate)
+{
+#if defined(COORDINATE_DOUBLE)
+    uint64_t bits = coordinateBits(coordinate);
+    return (bits & KEY_SIGN_BIT) ? ~bits : (bits | KEY_SIGN_BIT);
+#else
+    return (uint64_t) (int64_t) coordinate -
+           (uint64_t) (int64_t) std::numeric_limits<Coordinate>::min();
+#endif
+}
+
+/**
+ * @brief Maps a key back to its coordinate.
+ * @param key The key.
+ * @return The coordinate of the key.
+ */
+static Coordinate keyCoordinate(uint64_t const key)
+{
+#if defined(COORDINATE_DOUBLE)
+    uint64_t bits = (key & KEY_SIGN_BIT) ? (key & ~KEY_SIGN_BIT) : ~key;
+    double coordinate = 0;
+    memcpy(&coordinate, &bits, sizeof(coordinate));
+    return coordinate;
+#else
+    return (Coordinate) (int64_t) (key +
+                                   (uint64_t) (int64_t) std::numeric_limits<Coordinate>::min());
+#endif
+}
+
+/**
+ * @brief Appends a variable length integer, 7 bits in every byte from the lowest bits.
+ * @param data The encoded data to append to.
+ * @param value The value to append.
+ */
+static void writeVarint(std::vector<uint8_t>& data, uint64_t value)
+{
+    while (value >= VARINT_CONTINUE)
+    {
+        data.push_back((uint8_t) ((value & VARINT_PAYLOAD_MASK) | VARINT_CONTINUE));
+        value >>= VARINT_PAYLOAD_BITS;
+    }
+    data.push_back((uint8_t) value);
+}
+
+/**
+ * @brief Reads a variable length integer.
+ * @param data The encoded data.
+ * @param offset The offset of the integer, which is moved past it.
+ * @return The value of the integer.
+ */
+static uint64_t readVarint(const uint8_t *data, size_t& offset)
+{
+    uint64_t value = 0;
+    int shift = 0;
+    uint8_t byte = 0;
+    do
+    {
+        byte = data[offset++];
+        value |= (uint64_t) (byte & VARINT_PAYLOAD_MASK) << shift;
+        shift += VARINT_PAYLOAD_BITS;
+    } while (byte & VARINT_CONTINUE);
+    return value;
+}
+
+/**
+ * @brief Encodes a signed difference (modulo 2^64) so small negative and positive differences
+ *        have small values: 0, -1, 1, -2, 2... become 0, 1, 2, 3, 4...
+ * @param difference The difference.
+ * @return The encoded difference.
+ */
+static uint64_t zigzagEncode(uint64_t const difference)
+{
+    return (difference << 1) ^ (uint64_t) ((int64_t) difference >> 63);
+}
+
+/**
+ * @brief Decodes a difference which was encoded by zigzagEncode.
+ * @param value The encoded difference.
+ * @return The difference.
+ */
+static uint64_t zigzagDecode(uint64_t const value)
+{
+    return (value >> 1) ^ (0 - (value & 1));
+}
+
+/**
+ * @brief A comparator function which compares 2 Points by their X and then Y coordinates.
+ * @param point1 The first Point to compare.
+ * @param point2 The second Point to compare.
+ * @return true if the first Point is smaller then the second Point.
+ */
+static bool xComparator(const Point& point1, const Point& point2)
+{
+    return point1.lessByX(point2);
+}
+
+
+/*-----=  FrozenPointSet Iterator  =-----*/
+
+
+/**
+ * @brief A Default Constructor for the iterator, which create an iterator past the end of an
+ *        empty FrozenPointSet.
+ */
+FrozenPointSet::const_iterator::const_iterator() : _set(nullptr), _index(EMPTY_SET_SIZE),
+                                                   _offset(0), _keyX(0), _keyY(0)
+{
+
+}
+
+/**
+ * @brief A Constructor for the iterator, which starts at the first Point of a block.
+ * @param set The FrozenPointSet.
+ * @param block The index of the block, or the number of blocks for the end iterator.
+ */
+FrozenPointSet::const_iterator::const_iterator(const FrozenPointSet *set, int const block)
+        : _set(set), _index(set -> _size), _offset(0), _keyX(0), _keyY(0)
+{
+    if (block < (int) set -> _blocks.size())
+    {
+        const BlockEntry& entry = set -> _blocks[block];
+        _index = block * FROZEN_BLOCK_SIZE;
+        _offset = entry.offset;
+        _point = entry.first;
+        _keyX = coordinateKey(_point.getX());
+        _keyY = coordinateKey(_point.getY());
+    }
+}
+
+/**
+ * @brief Moves the iterator to the next Point: the first Point of a block is read from the index,
+ *        and every other Point is decoded from the differences of its keys.
+ * @return This iterator.
+ */
+FrozenPointSet::const_iterator& FrozenPointSet::const_iterator::operator++()
+{
+    if (++_index == _set -> _size)
+    {
+        return *this;
+    }
+    if (_index % FROZEN_BLOCK_SIZE == 0)
+    {
+        *this = const_iterator(_set, _index / FROZEN_BLOCK_SIZE);
+        return *this;
+    }
+    _keyX += readVarint(_set -> _data.data(), _offset);
+    _keyY += zigzagDecode(readVarint(_set -> _data.data(), _offset));
+    _point.set(keyCoordinate(_keyX), keyCoordinate(_keyY));
+    return *this;
+}
+
+/**
+ * @brief Moves the iterator to the next Point.
+ * @return A copy of the iterator before the move.
+ */
+FrozenPointSet::const_iterator FrozenPointSet::const_iterator::operator++(int)
+{
+    const_iterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+
+/*-----=  FrozenPointSet Constructors  =-----*/
+
+
+/**
+ * @brief A Default Constructor for the FrozenPointSet, which create an empty Set.
+ */
+FrozenPointSet::FrozenPointSet() : _size(EMPTY_SET_SIZE), _lastKeyX(0), _lastKeyY(0)
+{
+
+}
+
+/**
+ * @brief A Constructor for the FrozenPointSet, which freezes the given distinct Points (a
+ *        PointSet may be given, as it is converted to a view) in O(n*log(n)).
+ * @param points The Points to freeze.
+ */
+FrozenPointSet::FrozenPointSet(PointSetView const points) : FrozenPointSet()
+{
+    std::vector<Point> sorted(points.begin(), points.end());
+    std::sort(sorted.begin(), sorted.end(), xComparator);
+    for (const Point& point : sorted)
+    {
+        _append(point);
+    }
+    _shrink();
+}
+
+
+/*-----=  FrozenPointSet Methods  =-----*/
+
+
+/**
+ * @brief Appends a Point, which is larger than all the Points of the Set in the X and then Y
+ *        order, to the end of the Set. The first Point of a block starts a new index entry.
+ * @param point The Point to append.
+ */
+void FrozenPointSet::_append(const Point& point)
+{
+    uint64_t keyX = coordinateKey(point.getX());
+    uint64_t keyY = coordinateKey(point.getY());
+    if (_size % FROZEN_BLOCK_SIZE == 0)
+    {
+        _blocks.push_back({point, _data.size()});
+    }
+    else
+    {
+        writeVarint(_data, keyX - _lastKeyX);
+        writeVarint(_data, zigzagEncode(keyY - _lastKeyY));
+    }
+    _lastKeyX = keyX;
+    _lastKeyY = keyY;
+    _size++;
+}
+
+/**
+ * @brief Releases the spare capacity which was left by the appending of the Points.
+ */
+void FrozenPointSet::_shrink()
+{
+    _blocks.shrink_to_fit();
+    _data.shrink_to_fit();
+}
+
+/**
+ * @brief Returns the number of bytes which the FrozenPointSet takes, with its index.
+ * @return The number of bytes.
+ */
+size_t FrozenPointSet::bytes() const
+{
+    return sizeof(*this) + _blocks.capacity() * sizeof(BlockEntry) + _data.capacity();
+}
+
+/**
+ * @brief Returns an iterator to the first Point of the FrozenPointSet.
+ * @return An iterator to the first Point.
+ */
+FrozenPointSet::const_iterator FrozenPointSet::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+/**
+ * @brief Returns an iterator past the last Point of the FrozenPointSet.
+ * @return An iterator past the last Point.
+ */
+FrozenPointSet::const_iterator FrozenPointSet::end() const
+{
+    return const_iterator(this, (int) _blocks.size());
+}
+
+/**
+ * @brief Checks if a given Point is in the FrozenPointSet, by a binary search of its block in the
+ *        index and a scan of the block, in O(log(n)).
+ * @param point The Point to find.
+ * @return true if the Point is in the FrozenPointSet, false otherwise.
+ */
+bool FrozenPointSet::contains(const Point& point) const
+{
+    // The block of the Point is the last block which starts at a Point that is not larger.
+    std::vector<BlockEntry>::const_iterator next =
+            std::upper_bound(_blocks.begin(), _blocks.end(), point,
+                             [](const Point& target, const BlockEntry& entry)
+                             {
+                                 return target.lessByX(entry.first);
+                             });
+    if (next == _blocks.begin())
+    {
+        return false;
+    }
+
+    const_iterator current(this, (int) (next - _blocks.begin()) - 1);
+    const_iterator last(this, (int) (next - _blocks.begin()));
+    for ( ; (current != last) && !point.lessByX(*current); ++current)
+    {
+        if (*current == point)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Thaws the FrozenPointSet back to a PointSet in O(n).
+ * @return A PointSet with the Points, sorted by their X and then Y coordinates.
+ */
+PointSet FrozenPointSet::thaw() const
+{
+    std::vector<Point> points(begin(), end());
+    return PointSet(points.data(), (int) points.size());
+}
+
+/**
+ * @brief Collects the Points of this Set which are (or are not) in the given Set, by merging the 2
+ *        sorted Sets in linear time.
+ * @param other The Set to check the Points against.
+ * @param inOther true to collect the Points which are in the other Set, false to collect the
+ *        Points which are not.
+ * @return A FrozenPointSet with the collected Points.
+ */
+FrozenPointSet FrozenPointSet::_select(const FrozenPointSet& other, bool const inOther) const
+{
+    FrozenPointSet result;
+    const_iterator otherPoint = other.begin();
+    const_iterator otherEnd = other.end();
+    for (const Point& point : *this)
+    {
+        while ((otherPoint != otherEnd) && otherPoint -> lessByX(point))
+        {
+            ++otherPoint;
+        }
+        if (((otherPoint != otherEnd) && (*otherPoint == point)) == inOther)
+        {
+            result._append(point);
+        }
+    }
+    result._shrink();
+    return result;
+}
+
+
+/*-----=  FrozenPointSet Operators Overload  =-----*/
+
+
+/**
+ * @brief An operator overload for the subtract operator '-' which subtracts all the Points that
+ *        appears in the given FrozenPointSet from this FrozenPointSet, in linear time.
+ * @param other The FrozenPointSet to subtract with.
+ * @return FrozenPointSet which include only the Points that appears in this FrozenPointSet and
+ *         not in the other FrozenPointSet.
+ */
+FrozenPointSet FrozenPointSet::operator-(const FrozenPointSet& other) const
+{
+    return _select(other, false);
+}
+
+/**
+ * @brief An operator overload for the intersect operator '&' which intersect the Points from this
+ *        FrozenPointSet and the given FrozenPointSet, in linear time.
+ * @param other The FrozenPointSet to intersect with.
+ * @return FrozenPointSet which include only the Points that appears both in this FrozenPointSet
+ *         and in the other FrozenPointSet.
+ */
+FrozenPointSet FrozenPointSet::operator&(const FrozenPointSet& other) const
+{
+    return _select(other, true);
+}
+
+/**
+ * @brief An operator overload for the comparison operator '==' which compares this FrozenPointSet
+ *        with another given FrozenPointSet.
+ *        The encoding of a Set is unique, so equal Sets have the same index and encoded data.
+ * @param other The FrozenPointSet to compare to.
+ * @return true if both Sets contains the same elements, false otherwise.
+ */
+bool FrozenPointSet::operator==(const FrozenPointSet& other) const
+{
+    if ((_size != other._size) || (_data != other._data))
+    {
+        return false;
+    }
+    for (size_t block = 0; block < _blocks.size(); block++)
+    {
+        if (!(_blocks[block].first == other._blocks[block].first))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief An operator overload for the comparison operator '!=' which compares this FrozenPointSet
+ *        with another given FrozenPointSet.
+ * @param other The FrozenPointSet to compare to.
+ * @return true if the Sets does not contain the same elements, false otherwise.
+ */
+bool FrozenPointSet::operator!=(const FrozenPointSet& other) const
+{
+    return !(*this == other);
+}
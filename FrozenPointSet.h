@@ -0,0 +1,261 @@
+/**
+ * @file FrozenPointSet.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the FrozenPointSet Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the FrozenPointSet Class.
+ * Declaring the FrozenPointSet Class, it's methods and fields.
+ * A FrozenPointSet is a compact immutable form of a PointSet for data which is mostly read: the
+ * Points are sorted by their X and then Y coordinates and stored as variable length deltas in
+ * blocks, with a small index of the first Point of every block. Membership tests, iteration and
+ * the Set operations work on the compressed data, and the Set may be thawed back to a PointSet.
+ * A FrozenPointSet is never modified, so many threads may read it at the same time.
+ */
+
+
+#ifndef EX1_FROZENPOINTSET_H
+#define EX1_FROZENPOINTSET_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include "PointSetView.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def FROZEN_BLOCK_SIZE 128
+ * @brief A Macro that sets the number of Points in a block of a FrozenPointSet.
+ */
+#define FROZEN_BLOCK_SIZE 128
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing an immutable compressed Set of Points.
+ *        Every coordinate is mapped to an unsigned key with the same order. The first Point of a
+ *        block is kept in the index, and every other Point is kept as the difference of its keys
+ *        from the keys of the previous Point: the X difference is never negative, and the Y
+ *        difference is zigzag encoded, both as variable length integers of 7 bits per byte.
+ *        Close Points in X order take 2 or 3 bytes instead of a whole Point.
+ */
+class FrozenPointSet
+{
+public:
+
+    /**
+     * @brief The forward iterator of the FrozenPointSet, which decodes the Points one at a time,
+     *        in the order of their X and then Y coordinates.
+     *        The iterators are valid as long as the FrozenPointSet exists.
+     */
+    class const_iterator : public std::iterator<std::forward_iterator_tag, Point, std::ptrdiff_t,
+                                                const Point *, const Point&>
+    {
+    public:
+
+        /**
+         * @brief A Default Constructor for the iterator, which create an iterator past the end of
+         *        an empty FrozenPointSet.
+         */
+        const_iterator();
+
+        /**
+         * @brief Returns the current Point.
+         * @return The current Point.
+         */
+        const Point& operator*() const { return _point; };
+
+        /**
+         * @brief Returns a pointer to the current Point.
+         * @return A pointer to the current Point.
+         */
+        const Point *operator->() const { return &_point; };
+
+        /**
+         * @brief Moves the iterator to the next Point.
+         * @return This iterator.
+         */
+        const_iterator& operator++();
+
+        /**
+         * @brief Moves the iterator to the next Point.
+         * @return A copy of the iterator before the move.
+         */
+        const_iterator operator++(int);
+
+        /**
+         * @brief Compares this iterator with another iterator of the same FrozenPointSet.
+         * @param other The iterator to compare to.
+         * @return true if both iterators are at the same Point.
+         */
+        bool operator==(const const_iterator& other) const { return _index == other._index; };
+
+        /**
+         * @brief Compares this iterator with another iterator of the same FrozenPointSet.
+         * @param other The iterator to compare to.
+         * @return true if the iterators are at different Points.
+         */
+        bool operator!=(const const_iterator& other) const { return _index != other._index; };
+
+    private:
+        friend class FrozenPointSet;
+
+        // FrozenPointSet Iterator Private Fields.
+        const FrozenPointSet *_set;  // The FrozenPointSet.
+        int _index;  // The index of the current Point.
+        size_t _offset;  // The offset of the encoded next Point.
+        uint64_t _keyX;  // The key of the X coordinate of the current Point.
+        uint64_t _keyY;  // The key of the Y coordinate of the current Point.
+        Point _point;  // The current Point.
+
+        /**
+         * @brief A Constructor for the iterator, which starts at the first Point of a block.
+         * @param set The FrozenPointSet.
+         * @param block The index of the block, or the number of blocks for the end iterator.
+         */
+        const_iterator(const FrozenPointSet *set, int const block);
+    };
+
+    /**
+     * @brief A Default Constructor for the FrozenPointSet, which create an empty Set.
+     */
+    FrozenPointSet();
+
+    /**
+     * @brief A Constructor for the FrozenPointSet, which freezes the given distinct Points (a
+     *        PointSet may be given, as it is converted to a view) in O(n*log(n)).
+     * @param points The Points to freeze.
+     */
+    explicit FrozenPointSet(PointSetView const points);
+
+    /**
+     * @brief Returns the size of the FrozenPointSet, i.e. the number of Points in it.
+     * @return The size of the FrozenPointSet.
+     */
+    int size() const { return _size; };
+
+    /**
+     * @brief Returns the number of bytes which the FrozenPointSet takes, with its index.
+     * @return The number of bytes.
+     */
+    size_t bytes() const;
+
+    /**
+     * @brief Returns an iterator to the first Point of the FrozenPointSet.
+     * @return An iterator to the first Point.
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns an iterator past the last Point of the FrozenPointSet.
+     * @return An iterator past the last Point.
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Checks if a given Point is in the FrozenPointSet, by a binary search of its block in
+     *        the index and a scan of the block, in O(log(n)).
+     * @param point The Point to find.
+     * @return true if the Point is in the FrozenPointSet, false otherwise.
+     */
+    bool contains(const Point& point) const;
+
+    /**
+     * @brief Thaws the FrozenPointSet back to a PointSet in O(n).
+     * @return A PointSet with the Points, sorted by their X and then Y coordinates.
+     */
+    PointSet thaw() const;
+
+    /**
+     * @brief An operator overload for the subtract operator '-' which subtracts all the Points
+     *        that appears in the given FrozenPointSet from this FrozenPointSet, in linear time.
+     * @param other The FrozenPointSet to subtract with.
+     * @return FrozenPointSet which include only the Points that appears in this FrozenPointSet
+     *         and not in the other FrozenPointSet.
+     */
+    FrozenPointSet operator-(const FrozenPointSet& other) const;
+
+    /**
+     * @brief An operator overload for the intersect operator '&' which intersect the Points
+     *        from this FrozenPointSet and the given FrozenPointSet, in linear time.
+     * @param other The FrozenPointSet to intersect with.
+     * @return FrozenPointSet which include only the Points that appears both in this
+     *         FrozenPointSet and in the other FrozenPointSet.
+     */
+    FrozenPointSet operator&(const FrozenPointSet& other) const;
+
+    /**
+     * @brief An operator overload for the comparison operator '==' which compares this
+     *        FrozenPointSet with another given FrozenPointSet.
+     * @param other The FrozenPointSet to compare to.
+     * @return true if both Sets contains the same elements, false otherwise.
+     */
+    bool operator==(const FrozenPointSet& other) const;
+
+    /**
+     * @brief An operator overload for the comparison operator '!=' which compares this
+     *        FrozenPointSet with another given FrozenPointSet.
+     * @param other The FrozenPointSet to compare to.
+     * @return true if the Sets does not contain the same elements, false otherwise.
+     */
+    bool operator!=(const FrozenPointSet& other) const;
+
+private:
+
+    /**
+     * @brief An entry of the block index.
+     */
+    struct BlockEntry
+    {
+        Point first;  // The first Point of the block.
+        size_t offset;  // The offset of the encoded second Point of the block.
+    };
+
+    // FrozenPointSet Private Fields.
+    int _size;  // The number of Points.
+    std::vector<BlockEntry> _blocks;  // The block index.
+    std::vector<uint8_t> _data;  // The encoded Points of all the blocks.
+    uint64_t _lastKeyX;  // The key of the X coordinate of the last appended Point.
+    uint64_t _lastKeyY;  // The key of the Y coordinate of the last appended Point.
+
+    /**
+     * @brief Appends a Point, which is larger than all the Points of the Set in the X and then Y
+     *        order, to the end of the Set.
+     * @param point The Point to append.
+     */
+    void _append(const Point& point);
+
+    /**
+     * @brief Releases the spare capacity which was left by the appending of the Points.
+     */
+    void _shrink();
+
+    /**
+     * @brief Collects the Points of this Set which are (or are not) in the given Set, by merging
+     *        the 2 sorted Sets.
+     * @param other The Set to check the Points against.
+     * @param inOther true to collect the Points which are in the other Set, false to collect the
+     *        Points which are not.
+     * @return A FrozenPointSet with the collected Points.
+     */
+    FrozenPointSet _select(const FrozenPointSet& other, bool const inOther) const;
+};
+
+
+#endif //EX1_FROZENPOINTSET_H
@@ -0,0 +1,645 @@
+/**
+ * @file HullAlgorithms.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the Convex Hull algorithms implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the Convex Hull algorithms implementation.
+ * Graham Scan:     The Algorithm runs as follow:
+ *                  Before the scan, the Points which are strictly inside the quadrilateral of the
+ *                  lowest, rightmost, highest and leftmost Points are discarded.
+ *                  First, it finds the Point with the minimal Y value
+ *                  (if there are 2 we take the one with the minimal X value as a tie breaker).
+ *                  Then we sort all the other Points in the PointSet by their Polar Angle
+ *                  according to the minimal Point we just found.
+ *                  when our Set is sorted, we can start run in a Counter-Clockwise direction
+ *                  and for each 3 Points we check if their orientation performs a Counter-Clockwise
+ *                  turn or not.
+ *                  If the turn is Counter-Clockwise, we continue, otherwise we remove these Points
+ *                  that make the bad turn and keep up to the next set of Points.
+ *                  We keep doing so until reaching the starting Point again and then we got our
+ *                  Convex Hull.
+ *                  The Algorithm running time complexity is O(n*log(n)) because we use sorting
+ *                  algorithms that run in O(n*log(n)). The running time of the orientation check
+ *                  and the first initialization of the PointSet within the user input is O(n).
+ *                  So we get O(n*log(n)).
+ *                  Reference:
+ *                      "Cormen, Leiserson, Rivest & Stein - Introduction to Algorithms", Page 1031.
+ * Monotone Chain:  For Points which are already sorted by their X coordinates, the lower Hull is
+ *                  built by a single scan from left to right and the upper Hull by a scan back,
+ *                  with the same turn check as the Graham Scan. The running time is O(n).
+ *                  Reference:
+ *                      "Andrew - Another Efficient Algorithm for Convex Hulls in Two Dimensions",
+ *                      1979.
+ * Chan:            An output sensitive algorithm, which runs in O(n*log(h)) for a Hull of h Points.
+ *                  A round with a guess m of the Hull size splits the Points to groups of m Points,
+ *                  calculates the Hull of each group with the Monotone Chain and then wraps the
+ *                  groups (the Jarvis March) from the lowest Point: every step takes from each group
+ *                  Hull the tangent from the current Point, and moves to the most Clockwise one.
+ *                  The tangent of each group only moves forward (Counter-Clockwise) during the
+ *                  march, so it is found by a pointer which passes each group Hull about once.
+ *                  If the wrap does not close within m steps, the next round squares the guess.
+ *                  Reference:
+ *                      "Chan - Optimal Output-Sensitive Convex Hull Algorithms in Two and Three
+ *                      Dimensions", 1996.
+ * Approximate:     The X range of the Points is split to k vertical strips of equal width, and
+ *                  only the lowest and highest Points of each strip (and of the leftmost and
+ *                  rightmost columns) are kept. These Points are already in X order, so their Hull
+ *                  is calculated with the Monotone Chain, in O(n + k) in total.
+ *                  Every input Point which is outside the approximate Hull is in a strip between
+ *                  the lowest and the highest Points of the strip, so it is closer to the Hull than
+ *                  the X extent of the Points of its strip, which is at most the strip width.
+ *                  Reference:
+ *                      "Bentley, Faust & Preparata - Approximation Algorithms for Convex Hulls",
+ *                      1982.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include <vector>
+#include "HullAlgorithms.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def FILTER_MINIMUM_SIZE 8
+ * @brief A Macro that sets the minimal size of a PointSet for discarding its interior Points
+ *        before the Convex Hull algorithm.
+ */
+#define FILTER_MINIMUM_SIZE 8
+
+/**
+ * @def QUADRILATERAL_CORNERS 4
+ * @brief A Macro that sets the number of corners of the extreme Points quadrilateral.
+ */
+#define QUADRILATERAL_CORNERS 4
+
+/**
+ * @def INITIAL_RESULT_SIZE 2
+ * @brief A Macro that sets the initial size of the result Set in the Convex Hull algorithm.
+ */
+#define INITIAL_RESULT_SIZE 2
+
+/**
+ * @def INITIAL_GROUP_SIZE 4
+ * @brief A Macro that sets the group size (the Hull size guess) of the first round of Chan's
+ *        algorithm. Every next round squares it.
+ */
+#define INITIAL_GROUP_SIZE 4
+
+/**
+ * @def CHAN_MINIMUM_SIZE 4096
+ * @brief A Macro that sets the minimal size of an input for which Chan's algorithm is considered.
+ */
+#define CHAN_MINIMUM_SIZE 4096
+
+/**
+ * @def HULL_SAMPLE_SIZE 1024
+ * @brief A Macro that sets the number of Points in the sample which estimates the Hull size.
+ */
+#define HULL_SAMPLE_SIZE 1024
+
+/**
+ * @def HULL_GROWTH_EXPONENT (1.0 / 3)
+ * @brief A Macro that sets the exponent of the growth of the Hull size with the number of Points,
+ *        as for Points which are uniform in a disk (the Hull of Points in a polygon grows slower).
+ */
+#define HULL_GROWTH_EXPONENT (1.0 / 3)
+
+/**
+ * @def CHAN_COST_FACTOR 2
+ * @brief A Macro that sets how much more work Chan's algorithm does than the Graham Scan for every
+ *        bit of log(h) compared to a bit of log(n).
+ */
+#define CHAN_COST_FACTOR 2
+
+
+/**
+ * @def NO_POINT -1
+ * @brief A Macro that sets the Point index of an empty strip.
+ */
+#define NO_POINT -1
+
+/**
+ * @def EXACT_BOUND 0
+ * @brief A Macro that sets the error bound of an exact Hull.
+ */
+#define EXACT_BOUND 0
+
+
+/*-----=  Convex Hull Helpers  =-----*/
+
+
+/**
+ * @brief Determine if a given 3 Points create a Counter-Clockwise turn.
+ *        If the result of the calculation is negative - we get Clockwise turn.
+ *        If the result of the calculation is positive - we get Counter-Clockwise turn.
+ *        If the result of the calculation is zero - we get Collinear.
+ * @param pointA The first point to include in the calculation.
+ * @param pointB The second point to include in the calculation.
+ * @param pointC The third point to include in the calculation.
+ * @return true if the Points make a Counter-Clockwise turn.
+ */
+static bool counterClockwise(const Point& pointA, const Point& pointB, const Point& pointC)
+{
+    // The orientation is calculated in a type wide enough for the products of the differences.
+    return (pointA.orientation(pointB, pointC) > 0);
+}
+
+/**
+ * @brief Discards the Points of the given PointSet which can not be on the Convex Hull.
+ *        The lowest, rightmost, highest and leftmost Points are on the Hull, so every Point which
+ *        is strictly inside their quadrilateral is not (the Akl-Toussaint heuristic).
+ *        The extreme Points and the orientations are found with the bulk Point kernels.
+ * @param pointSet The PointSet to filter.
+ */
+static void discardInteriorPoints(PointSet& pointSet)
+{
+    if (pointSet.size() < FILTER_MINIMUM_SIZE)
+    {
+        return;
+    }
+
+    Point quadrilateral[QUADRILATERAL_CORNERS] = {pointSet.extremePoint(LOWEST_POINT),
+                                                  pointSet.extremePoint(RIGHTMOST_POINT),
+                                                  pointSet.extremePoint(HIGHEST_POINT),
+                                                  pointSet.extremePoint(LEFTMOST_POINT)};
+    pointSet.removeInterior(quadrilateral, QUADRILATERAL_CORNERS);
+}
+
+
+/*-----=  Convex Hull Algorithms  =-----*/
+
+
+/**
+ * @brief Calculate the Convex Hull of a given PointSet with the Graham Scan.
+ *        The Algorithm is specified in the header of this file.
+ *        Note that the given PointSet is reordered, and its interior Points are discarded.
+ * @param pointSet The PointSet that contain the Point to calculate their Convex Hull.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getConvexHull(PointSet& pointSet)
+{
+    PointSet resultSet;
+    discardInteriorPoints(pointSet);
+    pointSet.sortByPolar();
+
+    int i = 0;  // The index of the given PointSet.
+    int j = 0;  // The index for the result PointSet.
+
+    // Initialize the Result set with the first Points.
+    for ( ; (j < pointSet.size()) && (j < INITIAL_RESULT_SIZE); j++)
+    {
+        resultSet.add(pointSet[j]);
+    }
+
+    // Iterate on the Points in the given PointSet.
+    for (i = INITIAL_RESULT_SIZE ; i < pointSet.size(); i++)
+    {
+        // Every time we encounter a bad turn we remove the Point from the Set.
+        while ((j >= INITIAL_RESULT_SIZE) &&
+               (!counterClockwise(resultSet[j-2], resultSet[j-1], pointSet[i])))
+        {
+            resultSet.remove(resultSet[j-1]);
+            j--;
+        }
+
+        resultSet.add(pointSet[i]);
+        j++;
+    }
+    return resultSet;
+}
+
+/**
+ * @brief Calculate the Convex Hull of the given distinct Points, which are sorted by their X and
+ *        then Y coordinates, with the Monotone Chain in O(n).
+ *        The Algorithm is specified in the header of this file.
+ * @param points The sorted array of distinct Points.
+ * @param count The number of Points in the array.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getSortedConvexHull(const Point points[], int const count)
+{
+    std::vector<Point> hull(INITIAL_RESULT_SIZE * count);
+    int size = monotoneChain(points, count, hull.data());
+
+    // Start the Hull from the lowest Point, as the Graham Scan does.
+    std::vector<Point>::iterator lowest =
+            std::min_element(hull.begin(), hull.begin() + size,
+                             [](const Point& point1, const Point& point2)
+                             {
+                                 return point1.lessByY(point2);
+                             });
+    std::rotate(hull.begin(), lowest, hull.begin() + size);
+    return PointSet(hull.data(), size);
+}
+
+/**
+ * @brief Calculate the Convex Hull of the Points of a given view with the Graham Scan.
+ *        The Graham Scan reorders the Points, so they are copied once to a working PointSet and
+ *        the viewed Points are not changed.
+ * @param points The view of the Points.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getConvexHull(PointSetView const points)
+{
+    PointSet pointSet(points.begin(), points.size());
+    return getConvexHull(pointSet);
+}
+
+/**
+ * @brief Calculate the Convex Hull of the Points of a given view, which are sorted by their X and
+ *        then Y coordinates, with the Monotone Chain in O(n) and without copying them.
+ * @param points The sorted view of the Points.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getSortedConvexHull(PointSetView const points)
+{
+    return getSortedConvexHull(points.begin(), points.size());
+}
+
+/**
+ * @brief Replaces the given Points, which are sorted by their X and then Y coordinates and may
+ *        repeat, with their Convex Hull in O(n).
+ *        The Monotone Chain returns the lower Hull up to the rightmost Point and then the upper
+ *        Hull back from it, so the lower Hull is merged with the reversed upper Hull to sort the
+ *        Hull back in a single pass.
+ * @param points The sorted Points, which are replaced by the Hull Points sorted in the same order.
+ */
+void reduceToSortedHull(std::vector<Point>& points)
+{
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    if (points.empty())
+    {
+        return;
+    }
+    std::vector<Point> hull(INITIAL_RESULT_SIZE * points.size());
+    hull.resize(monotoneChain(points.data(), (int) points.size(), hull.data()));
+    std::vector<Point>::iterator upperStart = std::find(hull.begin(), hull.end(),
+                                                        points.back()) + 1;
+    points.clear();
+    std::merge(hull.begin(), upperStart, hull.rbegin(),
+               std::vector<Point>::reverse_iterator(upperStart), std::back_inserter(points),
+               [](const Point& point1, const Point& point2)
+               {
+                   return point1.lessByX(point2);
+               });
+}
+
+/**
+ * @brief Calculate the Convex Hull of the union of 2 Hulls in linear time, so Hulls of parts of
+ *        the Points (e.g. blocks of a stream) are combined without the Points themselves.
+ * @param hull1 The first Hull, sorted by the X and then Y coordinates.
+ * @param hull2 The second Hull, sorted by the X and then Y coordinates.
+ * @return The merged Hull, sorted by the X and then Y coordinates.
+ */
+std::vector<Point> mergeSortedHulls(const std::vector<Point>& hull1,
+                                    const std::vector<Point>& hull2)
+{
+    std::vector<Point> merged;
+    merged.reserve(hull1.size() + hull2.size());
+    std::merge(hull1.begin(), hull1.end(), hull2.begin(), hull2.end(),
+               std::back_inserter(merged), [](const Point& point1, const Point& point2)
+               {
+                   return point1.lessByX(point2);
+               });
+    reduceToSortedHull(merged);
+    return merged;
+}
+
+/**
+ * @brief Checks if a candidate tangent Point from the apex is beyond the current one, i.e. it is
+ *        Clockwise from the current one, or collinear with it and farther from the apex.
+ * @param apex The Point which the tangents are from.
+ * @param current The current tangent Point.
+ * @param candidate The candidate tangent Point.
+ * @return true if the candidate is beyond the current tangent Point.
+ */
+static bool beyondTangent(const Point& apex, const Point& current, const Point& candidate)
+{
+    int turn = apex.orientation(current, candidate);
+    return (turn < 0) ||
+           ((turn == 0) && (apex.squaredDistance(candidate) > apex.squaredDistance(current)));
+}
+
+/**
+ * @brief Finds the tangent from a given apex, which is outside a group Hull, to the group Hull.
+ *        The search starts from the previous tangent of the group and only moves forward.
+ * @param apex The Point which the tangent is from.
+ * @param hull The group Hull in Counter-Clockwise order.
+ * @param size The number of Points in the group Hull.
+ * @param start The index to start the search from.
+ * @return The index of the tangent Point, which has all the group Hull on its left.
+ */
+static int findTangent(const Point& apex, const Point hull[], int const size, int const start)
+{
+    int index = start;
+    for (int step = 0; step < size; step++)
+    {
+        // A convex polygon is seen from an outside Point with a single minimal angle, so a Point
+        // which is not beaten by its neighbours is the tangent.
+        const Point& next = hull[(index + 1) % size];
+        const Point& previous = hull[(index + size - 1) % size];
+        if (!beyondTangent(apex, hull[index], next) && !beyondTangent(apex, hull[index], previous))
+        {
+            break;
+        }
+        index = (index + 1) % size;
+    }
+    return index;
+}
+
+/**
+ * @brief Runs a single round of Chan's algorithm with a given guess of the Hull size.
+ * @param points The Points.
+ * @param groupSize The number of Points in every group, which is also the guess of the Hull size.
+ * @param hull The output Hull in Counter-Clockwise order, starting from the lowest Point.
+ * @return true if the Hull has at most groupSize Points and it was calculated, false otherwise.
+ */
+static bool chanRound(PointSetView const points, int const groupSize, std::vector<Point>& hull)
+{
+    // Calculate the Hull of every group, and keep all of them in a single array.
+    int groups = (points.size() + groupSize - 1) / groupSize;
+    std::vector<Point> vertices(INITIAL_RESULT_SIZE * points.size());
+    std::vector<int> starts(groups + 1, 0);
+    std::vector<Point> group;
+    for (int g = 0; g < groups; g++)
+    {
+        PointSetView groupPoints = points.subView(g * groupSize,
+                                                  std::min(groupSize,
+                                                           points.size() - g * groupSize));
+        group.assign(groupPoints.begin(), groupPoints.end());
+        std::sort(group.begin(), group.end(), [](const Point& point1, const Point& point2)
+                                              {
+                                                  return point1.lessByX(point2);
+                                              });
+        starts[g + 1] = starts[g] + monotoneChain(group.data(), (int) group.size(),
+                                                  vertices.data() + starts[g]);
+    }
+
+    // The lowest Point is on the Hull, and on the Hull of its group.
+    int lowestIndex = findExtremeIndex(points.begin(), points.size(), LOWEST_POINT);
+    const Point lowest = points[lowestIndex];
+    int currentGroup = lowestIndex / groupSize;
+    int currentIndex = findPointIndex(vertices.data() + starts[currentGroup],
+                                      starts[currentGroup + 1] - starts[currentGroup], lowest);
+
+    // Wrap the group Hulls from the lowest Point.
+    std::vector<int> tangents(groups, 0);
+    hull.assign(1, lowest);
+    for (int step = 0; step < groupSize; step++)
+    {
+        const Point apex = vertices[starts[currentGroup] + currentIndex];
+        int bestGroup = currentGroup;
+        int groupHullSize = starts[currentGroup + 1] - starts[currentGroup];
+        int bestIndex = (currentIndex + 1) % groupHullSize;
+        for (int g = 0; g < groups; g++)
+        {
+            if (g == currentGroup)
+            {
+                // The apex is a vertex of its own group Hull, so its tangent is the next vertex.
+                continue;
+            }
+            int size = starts[g + 1] - starts[g];
+            tangents[g] = findTangent(apex, vertices.data() + starts[g], size, tangents[g]);
+            if (beyondTangent(apex, vertices[starts[bestGroup] + bestIndex],
+                              vertices[starts[g] + tangents[g]]))
+            {
+                bestGroup = g;
+                bestIndex = tangents[g];
+            }
+        }
+
+        const Point& next = vertices[starts[bestGroup] + bestIndex];
+        if (next == lowest)
+        {
+            return true;
+        }
+        hull.push_back(next);
+        currentGroup = bestGroup;
+        currentIndex = bestIndex;
+    }
+    return false;
+}
+
+/**
+ * @brief Estimates the size of the Hull of the given Points from a sample.
+ *        The Hull of an evenly spaced sample of the Points is calculated, and its size is scaled
+ *        to the number of the Points with the Hull growth rate of Points in a disk.
+ * @param points The view of the Points.
+ * @return The estimated size of the Hull.
+ */
+static double estimateHullSize(PointSetView const points)
+{
+    if (points.size() <= HULL_SAMPLE_SIZE)
+    {
+        return points.size();
+    }
+
+    std::vector<Point> sample;
+    int stride = points.size() / HULL_SAMPLE_SIZE;
+    for (int i = 0; i < HULL_SAMPLE_SIZE; i++)
+    {
+        sample.push_back(points[i * stride]);
+    }
+    std::sort(sample.begin(), sample.end(), [](const Point& point1, const Point& point2)
+                                            {
+                                                return point1.lessByX(point2);
+                                            });
+    std::vector<Point> sampleHull(INITIAL_RESULT_SIZE * sample.size());
+    int sampleHullSize = monotoneChain(sample.data(), (int) sample.size(), sampleHull.data());
+    return sampleHullSize * pow((double) points.size() / HULL_SAMPLE_SIZE, HULL_GROWTH_EXPONENT);
+}
+
+/**
+ * @brief Calculate the Convex Hull of the Points of a given view with Chan's algorithm, in
+ *        O(n*log(h)) for a Hull of h Points. The viewed Points are not changed.
+ *        The Algorithm is specified in the header of this file.
+ * @param points The view of the Points.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getChanConvexHull(PointSetView const points)
+{
+    // The Points are copied once, so the interior Points are discarded as in the Graham Scan.
+    PointSet candidates(points.begin(), points.size());
+    discardInteriorPoints(candidates);
+
+    // The first guess is the estimated Hull size, instead of the fixed guess of the original
+    // algorithm, to save the rounds with too small guesses.
+    std::vector<Point> hull;
+    if (candidates.size() > 0)
+    {
+        long groupSize = std::max((long) INITIAL_GROUP_SIZE, (long) estimateHullSize(candidates));
+        while (!chanRound(candidates, (int) std::min(groupSize, (long) candidates.size()), hull))
+        {
+            groupSize *= groupSize;
+        }
+    }
+    return PointSet(hull.data(), (int) hull.size());
+}
+
+/**
+ * @brief Estimates from a sample whether the Hull of the given Points is small enough for Chan's
+ *        algorithm to be faster than the Graham Scan.
+ *        Chan's algorithm is preferred if log(h) of the estimated Hull size is small enough
+ *        compared to log(n).
+ * @param points The view of the Points.
+ * @return true if Chan's algorithm is expected to be faster, false otherwise.
+ */
+bool preferChanConvexHull(PointSetView const points)
+{
+    if (points.size() < CHAN_MINIMUM_SIZE)
+    {
+        return false;
+    }
+    return CHAN_COST_FACTOR * log2(estimateHullSize(points)) < log2((double) points.size());
+}
+
+/**
+ * @brief Calculate the Convex Hull of the Points of a given snapshot.
+ *        The Points of a sorted snapshot are used in place with the Monotone Chain, and the Points
+ *        of any other snapshot are copied to a PointSet for the Graham Scan.
+ * @param points The snapshot.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getConvexHull(const MappedPointSet& points)
+{
+    if (points.isSorted())
+    {
+        return getSortedConvexHull(points.points(), points.size());
+    }
+    PointSet pointSet = points.toPointSet();
+    return getConvexHull(pointSet);
+}
+
+/**
+ * @brief Adds a Point to the candidates of the approximate Hull, unless it is the last candidate.
+ *        The candidates are added in X order, so a repeated Point is always the last one.
+ * @param candidates The candidates of the approximate Hull.
+ * @param point The Point to add.
+ */
+static void addCandidate(std::vector<Point>& candidates, const Point& point)
+{
+    if (candidates.empty() || !(candidates.back() == point))
+    {
+        candidates.push_back(point);
+    }
+}
+
+/**
+ * @brief Calculate an approximate Convex Hull of the Points of a given view in O(n + k), where
+ *        k is the number of strips which the accuracy requires.
+ *        The Algorithm is specified in the header of this file. If the accuracy requires more
+ *        strips than Points, the exact Hull is calculated with Chan's algorithm instead.
+ * @param points The view of the Points.
+ * @param accuracy The required error bound, a positive distance.
+ * @return The approximate Hull and the error bound it achieved.
+ */
+ApproximateHull getApproximateConvexHull(PointSetView const points, double const accuracy)
+{
+    assert(accuracy > 0);
+    ApproximateHull result;
+    result.errorBound = EXACT_BOUND;
+    if (points.size() == 0)
+    {
+        return result;
+    }
+
+    // The leftmost and rightmost columns, which bound the strips.
+    PointSetView::const_iterator leftLow = points.begin(), leftHigh = points.begin();
+    PointSetView::const_iterator rightLow = points.begin(), rightHigh = points.begin();
+    for (PointSetView::const_iterator point = points.begin(); point != points.end(); ++point)
+    {
+        if ((point -> getX() < leftLow -> getX()) ||
+            ((point -> getX() == leftLow -> getX()) && (point -> getY() < leftLow -> getY())))
+        {
+            leftLow = point;
+        }
+        if ((point -> getX() < leftHigh -> getX()) ||
+            ((point -> getX() == leftHigh -> getX()) && (point -> getY() > leftHigh -> getY())))
+        {
+            leftHigh = point;
+        }
+        if ((point -> getX() > rightLow -> getX()) ||
+            ((point -> getX() == rightLow -> getX()) && (point -> getY() < rightLow -> getY())))
+        {
+            rightLow = point;
+        }
+        if ((point -> getX() > rightHigh -> getX()) ||
+            ((point -> getX() == rightHigh -> getX()) && (point -> getY() > rightHigh -> getY())))
+        {
+            rightHigh = point;
+        }
+    }
+
+    // The lowest and highest Points of every strip, and the X extent of its Points. The Points of
+    // the leftmost and rightmost columns are already represented by the columns.
+    Coordinate minX = leftLow -> getX(), maxX = rightLow -> getX();
+    double width = (double) maxX - (double) minX;
+    double requiredStrips = std::max(1.0, ceil(width / accuracy));
+    if (requiredStrips > points.size())
+    {
+        // More strips than Points cost more than the exact Hull.
+        result.hull = getChanConvexHull(points);
+        return result;
+    }
+    int strips = (int) requiredStrips;
+    std::vector<int> lowest(strips, NO_POINT), highest(strips, NO_POINT);
+    std::vector<Coordinate> stripMinX(strips, maxX), stripMaxX(strips, minX);
+    for (int i = 0; i < points.size(); i++)
+    {
+        const Point& point = points[i];
+        if ((point.getX() == minX) || (point.getX() == maxX))
+        {
+            continue;
+        }
+        int strip = std::min(strips - 1, (int) (((double) point.getX() - minX) / width * strips));
+        if ((lowest[strip] == NO_POINT) || (point.getY() < points[lowest[strip]].getY()))
+        {
+            lowest[strip] = i;
+        }
+        if ((highest[strip] == NO_POINT) || (point.getY() > points[highest[strip]].getY()))
+        {
+            highest[strip] = i;
+        }
+        stripMinX[strip] = std::min(stripMinX[strip], point.getX());
+        stripMaxX[strip] = std::max(stripMaxX[strip], point.getX());
+    }
+
+    // The strips are in X order, so only the 2 Points of each strip need to be ordered.
+    std::vector<Point> candidates;
+    addCandidate(candidates, *leftLow);
+    addCandidate(candidates, *leftHigh);
+    for (int strip = 0; strip < strips; strip++)
+    {
+        if (lowest[strip] == NO_POINT)
+        {
+            continue;
+        }
+        const Point& low = points[lowest[strip]];
+        const Point& high = points[highest[strip]];
+        addCandidate(candidates, low.lessByX(high) ? low : high);
+        addCandidate(candidates, low.lessByX(high) ? high : low);
+        result.errorBound = std::max(result.errorBound,
+                                     (double) stripMaxX[strip] - (double) stripMinX[strip]);
+    }
+    addCandidate(candidates, *rightLow);
+    addCandidate(candidates, *rightHigh);
+
+    result.hull = getSortedConvexHull(candidates.data(), (int) candidates.size());
+    return result;
+}
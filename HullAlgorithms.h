@@ -0,0 +1,140 @@
+/**
+ * @file HullAlgorithms.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the Convex Hull algorithms.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Convex Hull algorithms.
+ * Declaring the functions which calculate the Convex Hull of a PointSet (the Graham Scan or the
+ * output sensitive Chan's algorithm) and of Points which are already sorted (the Monotone Chain),
+ * and an approximate Convex Hull with a known error bound in linear time.
+ * All the functions return the Convex Hull in Counter-Clockwise order, starting from the Point
+ * with the minimal Y value (and the minimal X value among them), without collinear Points.
+ */
+
+
+#ifndef EX1_HULLALGORITHMS_H
+#define EX1_HULLALGORITHMS_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "PointSet.h"
+#include <vector>
+#include "PointSetSnapshot.h"
+#include "PointSetView.h"
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief An approximate Convex Hull. Its Points are input Points, so it is inside the exact Hull,
+ *        and every input Point is within the error bound distance from it.
+ */
+struct ApproximateHull
+{
+    PointSet hull;  // The approximate Hull in Counter-Clockwise order.
+    double errorBound;  // The maximal distance of an input Point from the approximate Hull.
+};
+
+
+/*-----=  Convex Hull Algorithms  =-----*/
+
+
+/**
+ * @brief Calculate the Convex Hull of a given PointSet with the Graham Scan.
+ *        Note that the given PointSet is reordered, and its interior Points are discarded.
+ * @param pointSet The PointSet that contain the Point to calculate their Convex Hull.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getConvexHull(PointSet& pointSet);
+
+/**
+ * @brief Calculate the Convex Hull of the given distinct Points, which are sorted by their X and
+ *        then Y coordinates, with the Monotone Chain in O(n).
+ * @param points The sorted array of distinct Points.
+ * @param count The number of Points in the array.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getSortedConvexHull(const Point points[], int const count);
+
+/**
+ * @brief Calculate the Convex Hull of the Points of a given view with the Graham Scan.
+ *        The Graham Scan reorders the Points, so they are copied once to a working PointSet and
+ *        the viewed Points are not changed.
+ * @param points The view of the Points.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getConvexHull(PointSetView const points);
+
+/**
+ * @brief Calculate the Convex Hull of the Points of a given view, which are sorted by their X and
+ *        then Y coordinates, with the Monotone Chain in O(n) and without copying them.
+ * @param points The sorted view of the Points.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getSortedConvexHull(PointSetView const points);
+
+/**
+ * @brief Replaces the given Points, which are sorted by their X and then Y coordinates and may
+ *        repeat, with their Convex Hull in O(n).
+ * @param points The sorted Points, which are replaced by the Hull Points sorted in the same order.
+ */
+void reduceToSortedHull(std::vector<Point>& points);
+
+/**
+ * @brief Calculate the Convex Hull of the union of 2 Hulls in linear time, so Hulls of parts of
+ *        the Points (e.g. blocks of a stream) are combined without the Points themselves.
+ * @param hull1 The first Hull, sorted by the X and then Y coordinates.
+ * @param hull2 The second Hull, sorted by the X and then Y coordinates.
+ * @return The merged Hull, sorted by the X and then Y coordinates.
+ */
+std::vector<Point> mergeSortedHulls(const std::vector<Point>& hull1,
+                                    const std::vector<Point>& hull2);
+
+/**
+ * @brief Calculate the Convex Hull of the Points of a given view with Chan's algorithm, in
+ *        O(n*log(h)) for a Hull of h Points. The viewed Points are not changed.
+ * @param points The view of the Points.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getChanConvexHull(PointSetView const points);
+
+/**
+ * @brief Estimates from a sample whether the Hull of the given Points is small enough for Chan's
+ *        algorithm to be faster than the Graham Scan.
+ * @param points The view of the Points.
+ * @return true if Chan's algorithm is expected to be faster, false otherwise.
+ */
+bool preferChanConvexHull(PointSetView const points);
+
+/**
+ * @brief Calculate the Convex Hull of the Points of a given snapshot.
+ *        The Points of a sorted snapshot are used in place with the Monotone Chain, and the Points
+ *        of any other snapshot are copied to a PointSet for the Graham Scan.
+ * @param points The snapshot.
+ * @return A PointSet which contains the result of the Convex Hull Points.
+ */
+PointSet getConvexHull(const MappedPointSet& points);
+
+/**
+ * @brief Calculate an approximate Convex Hull of the Points of a given view in O(n + k), where
+ *        k is the number of strips which the accuracy requires. If it requires more strips than
+ *        Points, the exact Hull is calculated instead.
+ *        The achieved error bound is at most the given accuracy, and is 0 for an exact Hull.
+ * @param points The view of the Points.
+ * @param accuracy The required error bound, a positive distance.
+ * @return The approximate Hull and the error bound it achieved.
+ */
+ApproximateHull getApproximateConvexHull(PointSetView const points, double const accuracy);
+
+
+#endif //EX1_HULLALGORITHMS_H
@@ -0,0 +1,293 @@
+/**
+ * @file HullPipeline.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the HullPipeline Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the HullPipeline Class implementation.
+ * Define the HullPipeline Class methods and fields.
+ * The reader cuts every block after its last complete line, and the rest of the line starts the
+ * next block, so each line is parsed by a single parser. The Hull of the union of the blocks is the
+ * Hull of the union of their Hulls, so every parser sorts its Points, reduces them to their Hull
+ * with the Monotone Chain and merges it to the Hull of the previous blocks in linear time. The
+ * merge runs outside the lock: a parser takes the Hull of the previous blocks out and merges it
+ * with its own, until it finds no Hull to take and puts back the merged one.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include "HullAlgorithms.h"
+#include "HullPipeline.h"
+#include "PointSetInput.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def PIPELINE_BLOCK_SIZE (1 << 20)
+ * @brief A Macro that sets the maximal number of bytes which the reader reads to a block at once.
+ */
+#define PIPELINE_BLOCK_SIZE (1 << 20)
+
+/**
+ * @def BUFFERS_PER_PARSER 2
+ * @brief A Macro that sets the number of buffers in the pool for every parser thread.
+ */
+#define BUFFERS_PER_PARSER 2
+
+/**
+ * @def END_OF_LINE '\n'
+ * @brief A Macro that sets the character which ends a line of the input.
+ */
+#define END_OF_LINE '\n'
+
+
+/*-----=  Parsing Helpers  =-----*/
+
+
+/**
+ * @brief Parse all the lines of a block to Points. The last line of the block ends with a new
+ *        line, unless it is the last line of the input.
+ * @param block The block.
+ * @param points The vector to append the parsed Points to.
+ */
+static void parseBlock(const std::vector<char>& block, std::vector<Point>& points)
+{
+    std::vector<char>::const_iterator lineStart = block.begin();
+    while (lineStart != block.end())
+    {
+        std::vector<char>::const_iterator lineEnd = std::find(lineStart, block.end(), END_OF_LINE);
+        points.push_back(parsePoint(std::string(lineStart, lineEnd)));
+        lineStart = (lineEnd == block.end()) ? lineEnd : lineEnd + 1;
+    }
+}
+
+
+/*-----=  HullPipeline Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the HullPipeline of the given file.
+ * @param fileDescriptor The file to read the "X,Y" lines from, e.g. a pipe.
+ * @param parsers The number of parser threads.
+ */
+HullPipeline::HullPipeline(int const fileDescriptor, int const parsers)
+        : _fileDescriptor(fileDescriptor), _parsers(parsers), _buffers(0), _inputEnded(false)
+{
+
+}
+
+
+/*-----=  HullPipeline Methods  =-----*/
+
+
+/**
+ * @brief Reads the file to its end and calculates the Convex Hull of its Points.
+ *        A parsing error in any thread is thrown from this method after all threads end.
+ * @return A PointSet which contains the Convex Hull Points, in Counter-Clockwise order starting
+ *         from the lowest Point.
+ */
+PointSet HullPipeline::run()
+{
+    std::thread reader(&HullPipeline::_read, this);
+    std::vector<std::thread> parsers;
+    for (int parser = 0; parser < _parsers; parser++)
+    {
+        parsers.emplace_back(&HullPipeline::_parse, this);
+    }
+    reader.join();
+    for (std::thread& parser : parsers)
+    {
+        parser.join();
+    }
+    if (_error)
+    {
+        std::rethrow_exception(_error);
+    }
+
+    // The merged Hull is sorted, so the Monotone Chain puts it in Counter-Clockwise order.
+    return getSortedConvexHull(_hull.data(), (int) _hull.size());
+}
+
+/**
+ * @brief Takes a free buffer for the reader, and waits if all of them are in use.
+ * @param buffer The buffer to set.
+ * @return true if a buffer was taken, false if the pipeline failed.
+ */
+bool HullPipeline::_takeBuffer(std::vector<char>& buffer)
+{
+    std::unique_lock<std::mutex> guard(_lock);
+    _bufferFree.wait(guard, [this]()
+                     {
+                         return !_freeBuffers.empty() ||
+                                (_buffers < BUFFERS_PER_PARSER * _parsers) || _error;
+                     });
+    if (_error)
+    {
+        return false;
+    }
+    if (_freeBuffers.empty())
+    {
+        _buffers++;
+        buffer.clear();
+        return true;
+    }
+    buffer = std::move(_freeBuffers.back());
+    _freeBuffers.pop_back();
+    return true;
+}
+
+/**
+ * @brief The loop of the reader thread, which reads the file to blocks of whole lines.
+ *        Every block is handed to the parsers as soon as it is read, even if the read returned
+ *        less than a whole block (as a pipe does when its writer is slow).
+ */
+void HullPipeline::_read()
+{
+    std::vector<char> rest;  // The start of a line which continues in the next block.
+    std::vector<char> buffer;
+    while (_takeBuffer(buffer))
+    {
+        buffer.assign(rest.begin(), rest.end());
+        buffer.resize(rest.size() + PIPELINE_BLOCK_SIZE);
+        ssize_t count = 0;
+        do
+        {
+            count = read(_fileDescriptor, buffer.data() + rest.size(), PIPELINE_BLOCK_SIZE);
+        } while ((count < 0) && (errno == EINTR));
+
+        if (count <= 0)
+        {
+            // The last line of the input may not end with a new line.
+            buffer.resize(rest.size());
+            std::lock_guard<std::mutex> guard(_lock);
+            if (buffer.empty())
+            {
+                _freeBuffers.push_back(std::move(buffer));
+            }
+            else
+            {
+                _blocks.push_back(std::move(buffer));
+            }
+            break;
+        }
+
+        // Cut the block after its last complete line.
+        buffer.resize(rest.size() + count);
+        std::vector<char>::reverse_iterator lastLineEnd = std::find(buffer.rbegin(), buffer.rend(),
+                                                                    END_OF_LINE);
+        rest.assign(lastLineEnd.base(), buffer.end());
+        buffer.erase(lastLineEnd.base(), buffer.end());
+
+        std::lock_guard<std::mutex> guard(_lock);
+        if (buffer.empty())
+        {
+            // A line which is longer than the block continues to the next block.
+            _freeBuffers.push_back(std::move(buffer));
+            continue;
+        }
+        _blocks.push_back(std::move(buffer));
+        _blockReady.notify_one();
+    }
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _inputEnded = true;
+    _blockReady.notify_all();
+}
+
+/**
+ * @brief The loop of a parser thread, which reduces a read block at a time to its Hull.
+ *        The buffer of the block is returned to the reader as soon as the block is parsed, and
+ *        the Hull of the block is merged to the Hull of the previous blocks.
+ *        A parsing error stops the whole pipeline.
+ */
+void HullPipeline::_parse()
+{
+    std::vector<Point> points;
+    while (true)
+    {
+        std::vector<char> block;
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _blockReady.wait(guard, [this]()
+                             {
+                                 return !_blocks.empty() || _inputEnded || _error;
+                             });
+            if (_blocks.empty() || _error)
+            {
+                return;
+            }
+            block = std::move(_blocks.front());
+            _blocks.pop_front();
+        }
+
+        points.clear();
+        try
+        {
+            parseBlock(block, points);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            if (!_error)
+            {
+                _error = std::current_exception();
+            }
+            _blockReady.notify_all();
+            _bufferFree.notify_all();
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _freeBuffers.push_back(std::move(block));
+            _bufferFree.notify_one();
+        }
+
+        std::sort(points.begin(), points.end(), [](const Point& point1, const Point& point2)
+                  {
+                      return point1.lessByX(point2);
+                  });
+        reduceToSortedHull(points);
+        _mergeHull(points);
+    }
+}
+
+/**
+ * @brief Merges a Hull of parsed blocks to the Hull of the previous blocks, outside the lock.
+ *        The Hull of the previous blocks is taken out under the lock and merged without it, and
+ *        the other parsers meanwhile put their Hulls in its place, so the merged Hull is put back
+ *        only when no Hull is waiting there, and it is merged with the waiting Hull otherwise.
+ * @param hull The Hull to merge, sorted by X and then Y. It is used as the merge buffer.
+ */
+void HullPipeline::_mergeHull(std::vector<Point>& hull)
+{
+    std::vector<Point> previous;
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            if (_hull.empty())
+            {
+                _hull.swap(hull);
+                return;
+            }
+            previous.swap(_hull);
+            _hull.clear();
+        }
+        hull = mergeSortedHulls(previous, hull);
+    }
+}
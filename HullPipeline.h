@@ -0,0 +1,106 @@
+/**
+ * @file HullPipeline.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the HullPipeline Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the HullPipeline Class.
+ * Declaring the HullPipeline Class, it's methods and fields.
+ * A HullPipeline calculates the Convex Hull of "X,Y" lines from a file while it is still being
+ * read: a reader thread reads the file to blocks of whole lines, and parser threads turn every
+ * block to Points, reduce them to the Hull of the block and merge it to the Hull of the blocks so
+ * far. A slow input (e.g. a pipe) is parsed as it arrives, and the input keeps being read during
+ * the calculation.
+ */
+
+
+#ifndef EX1_HULLPIPELINE_H
+#define EX1_HULLPIPELINE_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+#include "PointSet.h"
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing the pipeline of reading, parsing and reducing the Points of a file
+ *        to their Convex Hull.
+ *        The blocks are taken from a fixed pool of 2 buffers for every parser, so the reader fills
+ *        a buffer while the parsers work on the others, and it waits when all of them are full.
+ *        Only the Hulls of the blocks are kept, so the Points are never held all at once.
+ */
+class HullPipeline
+{
+public:
+
+    /**
+     * @brief A Constructor for the HullPipeline of the given file.
+     * @param fileDescriptor The file to read the "X,Y" lines from, e.g. a pipe.
+     * @param parsers The number of parser threads.
+     */
+    HullPipeline(int const fileDescriptor, int const parsers);
+
+    /**
+     * @brief Reads the file to its end and calculates the Convex Hull of its Points.
+     *        A parsing error in any thread is thrown from this method after all threads end.
+     * @return A PointSet which contains the Convex Hull Points, in Counter-Clockwise order starting
+     *         from the lowest Point.
+     */
+    PointSet run();
+
+private:
+    // HullPipeline Private Fields.
+    int _fileDescriptor;  // The file to read from.
+    int _parsers;  // The number of parser threads.
+    std::deque<std::vector<char>> _blocks;  // The read blocks which wait for a parser.
+    std::vector<std::vector<char>> _freeBuffers;  // The buffers which wait for the reader.
+    int _buffers;  // The number of buffers which were allocated.
+    std::mutex _lock;  // The lock which guards the blocks, the buffers and the Hull.
+    std::condition_variable _blockReady;  // Signaled when a block is read or the pipeline ends.
+    std::condition_variable _bufferFree;  // Signaled when a buffer is free or the pipeline fails.
+    bool _inputEnded;  // true if the reader reached the end of the file.
+    std::exception_ptr _error;  // The first parsing error, or null.
+    std::vector<Point> _hull;  // The Hull of the parsed blocks, sorted by X and then Y.
+
+    /**
+     * @brief The loop of the reader thread, which reads the file to blocks of whole lines.
+     */
+    void _read();
+
+    /**
+     * @brief The loop of a parser thread, which reduces a read block at a time to its Hull.
+     */
+    void _parse();
+
+    /**
+     * @brief Merges a Hull of parsed blocks to the Hull of the previous blocks, outside the lock.
+     * @param hull The Hull to merge, sorted by X and then Y. It is used as the merge buffer.
+     */
+    void _mergeHull(std::vector<Point>& hull);
+
+    /**
+     * @brief Takes a free buffer for the reader, and waits if all of them are in use.
+     * @param buffer The buffer to set.
+     * @return true if a buffer was taken, false if the pipeline failed.
+     */
+    bool _takeBuffer(std::vector<char>& buffer);
+};
+
+
+#endif //EX1_HULLPIPELINE_H
@@ -0,0 +1,252 @@
+/**
+ * @file HullQuery.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the HullQuery Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the HullQuery Class implementation.
+ * Define the HullQuery Class methods and fields.
+ * Containment:     The Hull is split to triangles which share the first Hull Point (a fan).
+ *                  A binary search on the orientation of the query Point with respect to the
+ *                  fan diagonals finds the only triangle which may contain it.
+ * Extreme Point:   The edges of a Convex Hull in Counter-Clockwise order are sorted by their
+ *                  angle. The extreme Point in a direction is the start of the first edge whose
+ *                  angle passes the direction rotated by Pi/2, which is found by a binary search.
+ * All the comparisons are done with exact integral arithmetic.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cassert>
+#include "HullQuery.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def FIRST_INDEX 0
+ * @brief A Macro that sets the index of the first Point of the Hull.
+ */
+#define FIRST_INDEX 0
+
+/**
+ * @def SINGLE_POINT_HULL 1
+ * @brief A Macro that sets the size of a Hull which contains a single Point.
+ */
+#define SINGLE_POINT_HULL 1
+
+/**
+ * @def SEGMENT_HULL 2
+ * @brief A Macro that sets the size of a Hull which is a single segment.
+ */
+#define SEGMENT_HULL 2
+
+/**
+ * @def UPPER_HALF_PLANE 0
+ * @brief A Macro that sets the value for vectors with angle in [0, Pi).
+ */
+#define UPPER_HALF_PLANE 0
+
+/**
+ * @def LOWER_HALF_PLANE 1
+ * @brief A Macro that sets the value for vectors with angle in [Pi, 2*Pi).
+ */
+#define LOWER_HALF_PLANE 1
+
+
+/*-----=  Query Helpers  =-----*/
+
+
+/**
+ * @brief Calculates the orientation of the Point C with respect to the directed line from A to B.
+ * @param pointA The start of the line.
+ * @param pointB The end of the line.
+ * @param pointC The Point to check.
+ * @return Positive for a Counter-Clockwise turn, negative for a Clockwise turn, zero if collinear.
+ */
+static int orientation(const Point& pointA, const Point& pointB, const Point& pointC)
+{
+    return pointA.orientation(pointB, pointC);
+}
+
+/**
+ * @brief Calculates the exact cross product of 2 given vectors.
+ * @param x1 The X coordinate of the first vector.
+ * @param y1 The Y coordinate of the first vector.
+ * @param x2 The X coordinate of the second vector.
+ * @param y2 The Y coordinate of the second vector.
+ * @return The cross product of the vectors.
+ */
+static CoordinateProduct cross(CoordinateDifference const x1, CoordinateDifference const y1,
+                               CoordinateDifference const x2, CoordinateDifference const y2)
+{
+    return (CoordinateProduct) x1 * y2 - (CoordinateProduct) y1 * x2;
+}
+
+/**
+ * @brief Checks if the given Point lies on the segment between A and B, assuming it is collinear
+ *        with them.
+ * @param pointA The first end of the segment.
+ * @param pointB The second end of the segment.
+ * @param point The Point to check.
+ * @return true if the Point is within the bounding box of the segment.
+ */
+static bool onSegment(const Point& pointA, const Point& pointB, const Point& point)
+{
+    return (std::min(pointA.getX(), pointB.getX()) <= point.getX()) &&
+           (point.getX() <= std::max(pointA.getX(), pointB.getX())) &&
+           (std::min(pointA.getY(), pointB.getY()) <= point.getY()) &&
+           (point.getY() <= std::max(pointA.getY(), pointB.getY()));
+}
+
+
+/*-----=  HullQuery Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the HullQuery, which builds the query structure from a given
+ *        Convex Hull in O(h).
+ * @param hull The Convex Hull in Counter-Clockwise order (as it is returned from the Convex
+ *        Hull calculation, before any sorting).
+ */
+HullQuery::HullQuery(const PointSet& hull)
+{
+    for (int i = 0; i < hull.size(); i++)
+    {
+        _vertices.push_back(hull[i]);
+    }
+    for (int i = 0; i < hull.size(); i++)
+    {
+        const Point& next = hull[(i + 1) % hull.size()];
+        Vector edge = {(CoordinateDifference) next.getX() - hull[i].getX(),
+                       (CoordinateDifference) next.getY() - hull[i].getY()};
+        _edges.push_back(edge);
+    }
+}
+
+
+/*-----=  HullQuery Queries  =-----*/
+
+
+/**
+ * @brief Checks if a given Point is inside the Hull (including its boundary).
+ * @param point The Point to check.
+ * @return true if the Point is inside the Hull or on its boundary, false otherwise.
+ */
+bool HullQuery::contains(const Point& point) const
+{
+    if (_vertices.empty())
+    {
+        return false;
+    }
+    const Point& origin = _vertices[FIRST_INDEX];
+    if (_vertices.size() == SINGLE_POINT_HULL)
+    {
+        return origin == point;
+    }
+    if (_vertices.size() == SEGMENT_HULL)
+    {
+        return (orientation(origin, _vertices[1], point) == 0) &&
+               onSegment(origin, _vertices[1], point);
+    }
+
+    // The Point must be inside the angle between the first and the last edges of the fan.
+    int last = size() - 1;
+    if ((orientation(origin, _vertices[1], point) < 0) ||
+        (orientation(origin, _vertices[last], point) > 0))
+    {
+        return false;
+    }
+
+    // Find the last fan diagonal which the Point is not on the right of.
+    int low = 1;
+    int high = last;
+    while (high - low > 1)
+    {
+        int middle = low + (high - low) / 2;
+        if (orientation(origin, _vertices[middle], point) >= 0)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    // The Point is inside the triangle (origin, low, low + 1) unless it is beyond the Hull edge.
+    return orientation(_vertices[low], _vertices[low + 1], point) >= 0;
+}
+
+/**
+ * @brief Returns the half of the plane of a given vector with respect to the direction of the
+ *        first Hull edge: 0 for angles in [0, Pi) and 1 for angles in [Pi, 2*Pi).
+ * @param vector The vector to check.
+ * @return The half of the plane of the vector.
+ */
+int HullQuery::_halfPlane(const Vector& vector) const
+{
+    const Vector& reference = _edges[FIRST_INDEX];
+    CoordinateProduct turn = cross(reference.x, reference.y, vector.x, vector.y);
+    CoordinateProduct dot = cross(reference.x, reference.y, -vector.y, vector.x);
+    return ((turn > 0) || ((turn == 0) && (dot > 0))) ? UPPER_HALF_PLANE : LOWER_HALF_PLANE;
+}
+
+/**
+ * @brief Compares the angles of 2 given vectors, measured Counter-Clockwise from the
+ *        direction of the first Hull edge, in the range [0, 2*Pi).
+ * @param vector1 The first vector to compare.
+ * @param vector2 The second vector to compare.
+ * @return true if the angle of the first vector is smaller than the angle of the second.
+ */
+bool HullQuery::_angleLess(const Vector& vector1, const Vector& vector2) const
+{
+    int half1 = _halfPlane(vector1);
+    int half2 = _halfPlane(vector2);
+    if (half1 != half2)
+    {
+        return half1 < half2;
+    }
+    return cross(vector1.x, vector1.y, vector2.x, vector2.y) > 0;
+}
+
+/**
+ * @brief Finds the Hull Point which is extreme in a given direction, i.e. the Point with the
+ *        maximal dot product with the direction. The Hull must not be empty.
+ * @param direction The direction vector, which must not be zero.
+ * @return The extreme Hull Point in the given direction.
+ */
+const Point& HullQuery::extremePoint(const Point& direction) const
+{
+    assert(!_vertices.empty());
+    if (_vertices.size() == SINGLE_POINT_HULL)
+    {
+        return _vertices[FIRST_INDEX];
+    }
+
+    // The edges before the extreme Point advance in the direction, and the edges after it go back.
+    // The switch is at the direction rotated by Pi/2.
+    Vector target = {-(CoordinateDifference) direction.getY(),
+                     (CoordinateDifference) direction.getX()};
+    std::vector<Vector>::const_iterator firstBackward =
+            std::partition_point(_edges.begin(), _edges.end(),
+                                 [this, &target](const Vector& edge)
+                                 {
+                                     return _angleLess(edge, target);
+                                 });
+    if (firstBackward == _edges.end())
+    {
+        return _vertices[FIRST_INDEX];
+    }
+    return _vertices[firstBackward - _edges.begin()];
+}
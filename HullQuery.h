@@ -0,0 +1,105 @@
+/**
+ * @file HullQuery.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the HullQuery Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the HullQuery Class.
+ * Declaring the HullQuery Class, it's methods and fields.
+ * A HullQuery class is built once from a Convex Hull and answers containment queries and
+ * directional extreme Point queries on that Hull in O(log(h)) each.
+ */
+
+
+#ifndef EX1_HULLQUERY_H
+#define EX1_HULLQUERY_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include "PointSet.h"
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a query structure over a Convex Hull.
+ *        The HullQuery holds a copy of the Hull Points in Counter-Clockwise order and the
+ *        directions of the Hull edges, and uses binary searches on them to answer queries.
+ */
+class HullQuery
+{
+public:
+
+    /**
+     * @brief A Constructor for the HullQuery, which builds the query structure from a given
+     *        Convex Hull in O(h).
+     * @param hull The Convex Hull in Counter-Clockwise order (as it is returned from the Convex
+     *        Hull calculation, before any sorting).
+     */
+    HullQuery(const PointSet& hull);
+
+    /**
+     * @brief Returns the number of Points in the Hull.
+     * @return The number of Points in the Hull.
+     */
+    int size() const { return (int) _vertices.size(); };
+
+    /**
+     * @brief Checks if a given Point is inside the Hull (including its boundary).
+     * @param point The Point to check.
+     * @return true if the Point is inside the Hull or on its boundary, false otherwise.
+     */
+    bool contains(const Point& point) const;
+
+    /**
+     * @brief Finds the Hull Point which is extreme in a given direction, i.e. the Point with the
+     *        maximal dot product with the direction. The Hull must not be empty.
+     * @param direction The direction vector, which must not be zero.
+     * @return The extreme Hull Point in the given direction.
+     */
+    const Point& extremePoint(const Point& direction) const;
+
+private:
+    /**
+     * @brief A vector in the plane, with exact coordinates for differences of Points.
+     */
+    struct Vector
+    {
+        CoordinateDifference x;  // The X coordinate of the vector.
+        CoordinateDifference y;  // The Y coordinate of the vector.
+    };
+
+    // HullQuery Private Fields.
+    std::vector<Point> _vertices;  // The Hull Points in Counter-Clockwise order.
+    std::vector<Vector> _edges;  // The edge vectors, edge i is from Point i to Point i+1.
+
+    /**
+     * @brief Compares the angles of 2 given vectors, measured Counter-Clockwise from the
+     *        direction of the first Hull edge, in the range [0, 2*Pi).
+     * @param vector1 The first vector to compare.
+     * @param vector2 The second vector to compare.
+     * @return true if the angle of the first vector is smaller than the angle of the second.
+     */
+    bool _angleLess(const Vector& vector1, const Vector& vector2) const;
+
+    /**
+     * @brief Returns the half of the plane of a given vector with respect to the direction of the
+     *        first Hull edge: 0 for angles in [0, Pi) and 1 for angles in [Pi, 2*Pi).
+     * @param vector The vector to check.
+     * @return The half of the plane of the vector.
+     */
+    int _halfPlane(const Vector& vector) const;
+};
+
+
+#endif //EX1_HULLQUERY_H
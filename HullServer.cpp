@@ -0,0 +1,294 @@
+/**
+ * @file HullServer.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the HullServer Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the HullServer Class implementation.
+ * Define the HullServer Class methods and fields.
+ * The Points of a request are collected with their repetitions, then sorted and made distinct in
+ * O(n*log(n)), so the PointSet of the request is built without the repetitions check.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "HullServer.h"
+#include "PointSetInput.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def RECEIVE_BLOCK_SIZE (1 << 16)
+ * @brief A Macro that sets the number of bytes which a worker receives from a client at once.
+ */
+#define RECEIVE_BLOCK_SIZE (1 << 16)
+
+/**
+ * @def END_OF_LINE '\n'
+ * @brief A Macro that sets the character which ends a line of a request.
+ */
+#define END_OF_LINE '\n'
+
+/**
+ * @def END_OF_REPLY "\n"
+ * @brief A Macro that sets the empty line which ends a reply.
+ */
+#define END_OF_REPLY "\n"
+
+/**
+ * @def ERROR_REPLY "error "
+ * @brief A Macro that sets the beginning of the reply to a request which can not be answered.
+ */
+#define ERROR_REPLY "error "
+
+/**
+ * @def NO_SOCKET -1
+ * @brief A Macro that sets the value of a socket which is not open.
+ */
+#define NO_SOCKET -1
+
+
+/*-----=  HullServer Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the HullServer, which listens on the given socket path.
+ *        An existing file in the path is replaced.
+ *        Throws std::runtime_error if the socket can not be created.
+ * @param path The path of the Unix domain socket.
+ * @param workers The number of worker threads, i.e. the number of clients which are served
+ *        at the same time.
+ * @param handler The function which answers the requests.
+ */
+HullServer::HullServer(const std::string& path, int const workers, HullRequestHandler handler)
+        : _path(path), _socket(NO_SOCKET), _handler(handler), _stopped(false)
+{
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        throw std::runtime_error("The socket path is too long " + path);
+    }
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    _socket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (_socket < 0)
+    {
+        throw std::runtime_error("Can not create the socket " + path);
+    }
+    unlink(path.c_str());
+    if ((bind(_socket, (const struct sockaddr *) &address, sizeof(address)) != 0) ||
+        (listen(_socket, SOMAXCONN) != 0))
+    {
+        close(_socket);
+        throw std::runtime_error("Can not listen on the socket " + path);
+    }
+
+    for (int i = 0; i < workers; i++)
+    {
+        _workers.emplace_back(&HullServer::_work, this);
+    }
+}
+
+/**
+ * @brief A Destructor for the HullServer, which closes the socket and removes its path.
+ */
+HullServer::~HullServer()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stopped = true;
+    }
+    _waiting.notify_all();
+    for (std::thread& worker : _workers)
+    {
+        worker.join();
+    }
+    for (int connection : _connections)
+    {
+        close(connection);
+    }
+    close(_socket);
+    unlink(_path.c_str());
+}
+
+
+/*-----=  HullServer Methods  =-----*/
+
+
+/**
+ * @brief Accepts the connections of clients and hands them to the workers.
+ *        Returns only when accepting a connection fails.
+ */
+void HullServer::run()
+{
+    while (true)
+    {
+        int connection = accept(_socket, nullptr, nullptr);
+        if (connection < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _connections.push_back(connection);
+        }
+        _waiting.notify_one();
+    }
+}
+
+/**
+ * @brief The loop of a worker thread, which serves a waiting connection at a time.
+ */
+void HullServer::_work()
+{
+    // The buffers of the worker are kept warm between connections and requests.
+    std::vector<char> buffer(RECEIVE_BLOCK_SIZE);
+    std::vector<Point> points;
+    while (true)
+    {
+        int connection;
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _waiting.wait(guard, [this]() { return _stopped || !_connections.empty(); });
+            if (_stopped)
+            {
+                return;
+            }
+            connection = _connections.front();
+            _connections.pop_front();
+        }
+        _serve(connection, buffer, points);
+        close(connection);
+    }
+}
+
+/**
+ * @brief Answers all the requests of a single connection, until the client closes it.
+ * @param connection The connection.
+ * @param buffer The buffer of the received bytes, kept by the worker between connections.
+ * @param points The Points of the current request, kept by the worker between requests.
+ */
+void HullServer::_serve(int const connection, std::vector<char>& buffer,
+                        std::vector<Point>& points)
+{
+    std::string currentInput;
+    std::string error;
+    points.clear();
+    while (true)
+    {
+        ssize_t received = recv(connection, buffer.data(), buffer.size(), 0);
+        if ((received < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        if (received <= 0)
+        {
+            // The client closed the connection (an unfinished request is not answered).
+            return;
+        }
+
+        for (ssize_t i = 0; i < received; i++)
+        {
+            if (buffer[i] != END_OF_LINE)
+            {
+                currentInput.push_back(buffer[i]);
+                continue;
+            }
+            if (!currentInput.empty())
+            {
+                // A request line. After an error, the rest of the request is only skipped.
+                if (error.empty())
+                {
+                    try
+                    {
+                        points.push_back(parsePoint(currentInput));
+                    }
+                    catch (const std::exception& exception)
+                    {
+                        error = "Invalid input line " + currentInput;
+                    }
+                }
+                currentInput.clear();
+                continue;
+            }
+
+            // An empty line ends the request.
+            std::string reply = _answer(points, error);
+            for (size_t sent = 0; sent < reply.size(); )
+            {
+                ssize_t current = send(connection, reply.data() + sent, reply.size() - sent,
+                                       MSG_NOSIGNAL);
+                if ((current < 0) && (errno == EINTR))
+                {
+                    continue;
+                }
+                if (current < 0)
+                {
+                    return;
+                }
+                sent += (size_t) current;
+            }
+            points.clear();
+            error.clear();
+        }
+    }
+}
+
+/**
+ * @brief Answers a single request.
+ * @param points The Points of the request, with possible repetitions.
+ * @param error The parsing error of the request, or an empty string.
+ * @return The reply, including the empty line at its end.
+ */
+std::string HullServer::_answer(std::vector<Point>& points, const std::string& error)
+{
+    std::ostringstream reply;
+    if (!error.empty())
+    {
+        reply << ERROR_REPLY << error << END_OF_REPLY << END_OF_REPLY;
+        return reply.str();
+    }
+
+    // The distinct Points are sorted, so the PointSet is built in O(n).
+    std::sort(points.begin(), points.end(), [](const Point& point1, const Point& point2)
+    {
+        return point1.lessByX(point2);
+    });
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    PointSet pointSet(points.data(), (int) points.size());
+    try
+    {
+        _handler(pointSet, reply);
+    }
+    catch (const std::exception& exception)
+    {
+        reply.str("");
+        reply << ERROR_REPLY << exception.what() << END_OF_REPLY;
+    }
+    reply << END_OF_REPLY;
+    return reply.str();
+}
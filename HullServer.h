@@ -0,0 +1,129 @@
+/**
+ * @file HullServer.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the HullServer Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the HullServer Class.
+ * Declaring the HullServer Class, it's methods and fields.
+ * A HullServer is a long running server on a Unix domain socket, which answers PointSet requests
+ * without starting a process for each one.
+ * A request is the "X,Y" lines of its Points followed by an empty line, and the reply is the
+ * output of the request followed by an empty line (or an "error" line and an empty line if the
+ * request can not be parsed). A client may send many requests on the same connection.
+ */
+
+
+#ifndef EX1_HULLSERVER_H
+#define EX1_HULLSERVER_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "PointSet.h"
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A function which answers a single request: it gets the PointSet of the request (which
+ *        it may change) and writes the reply output to the given stream.
+ */
+typedef std::function<void(PointSet& pointSet, std::ostream& reply)> HullRequestHandler;
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a server which answers PointSet requests on a Unix domain socket.
+ *        The connections are served by a fixed pool of worker threads, and each worker keeps its
+ *        buffers between requests, so a request does not pay for the threads and allocations.
+ */
+class HullServer
+{
+public:
+
+    /**
+     * @brief A Constructor for the HullServer, which listens on the given socket path.
+     *        An existing file in the path is replaced.
+     *        Throws std::runtime_error if the socket can not be created.
+     * @param path The path of the Unix domain socket.
+     * @param workers The number of worker threads, i.e. the number of clients which are served
+     *        at the same time.
+     * @param handler The function which answers the requests.
+     */
+    HullServer(const std::string& path, int const workers, HullRequestHandler handler);
+
+    /**
+     * @brief The HullServer owns a socket and threads, so it can not be copied.
+     */
+    HullServer(const HullServer& other) = delete;
+
+    /**
+     * @brief The HullServer owns a socket and threads, so it can not be assigned.
+     */
+    HullServer& operator=(const HullServer& other) = delete;
+
+    /**
+     * @brief A Destructor for the HullServer, which closes the socket and removes its path.
+     */
+    ~HullServer();
+
+    /**
+     * @brief Accepts the connections of clients and hands them to the workers.
+     *        Returns only when accepting a connection fails.
+     */
+    void run();
+
+private:
+    // HullServer Private Fields.
+    std::string _path;  // The path of the socket.
+    int _socket;  // The listening socket.
+    HullRequestHandler _handler;  // The function which answers the requests.
+    std::vector<std::thread> _workers;  // The worker threads.
+    std::deque<int> _connections;  // The accepted connections which wait for a worker.
+    std::mutex _lock;  // The lock which guards the waiting connections.
+    std::condition_variable _waiting;  // Signaled when a connection waits or the server stops.
+    bool _stopped;  // true if the server stopped, and the workers should end.
+
+    /**
+     * @brief The loop of a worker thread, which serves a waiting connection at a time.
+     */
+    void _work();
+
+    /**
+     * @brief Answers all the requests of a single connection, until the client closes it.
+     * @param connection The connection.
+     * @param buffer The buffer of the received bytes, kept by the worker between connections.
+     * @param points The Points of the current request, kept by the worker between requests.
+     */
+    void _serve(int const connection, std::vector<char>& buffer, std::vector<Point>& points);
+
+    /**
+     * @brief Answers a single request.
+     * @param points The Points of the request, with possible repetitions.
+     * @param error The parsing error of the request, or an empty string.
+     * @return The reply, including the empty line at its end.
+     */
+    std::string _answer(std::vector<Point>& points, const std::string& error);
+};
+
+
+#endif //EX1_HULLSERVER_H
@@ -1,146 +1,217 @@
-/**
- * @file Point.cpp
- * @author Itai Tagar <itagar>
- * @version 1.7
- * @date 04 Sep 2016
- *
- * @brief A File for the Point Class implementation.
- *
- * @section LICENSE
- * This program is free to use in every operation system.
- *
- * @section DESCRIPTION
- * A File for the Point Class implementation.
- * Define the Point Class methods and fields.
- * A Point class is a single Point with X and Y coordinates in the plane.
- */
-
-
-/*-----=  Includes  =-----*/
-
-
-#include <cmath>
-#include "Point.h"
-
-
-/*-----=  Definitions  =-----*/
-
-
-/**
- * @def DEFAULT_COORDINATE_VALUE 0
- * @brief A Macro that sets the default value for a Point's coordinate.
- */
-#define DEFAULT_COORDINATE_VALUE 0
-
-/**
- * @def PI 3.14
- * @brief A Macro that sets the value of the number Pi.
- */
-#define PI 3.141592
-
-/**
- * @def ANGLE_FACTOR 180
- * @brief A Macro that sets the value for the factor calculating the Polar Angle.
- */
-#define ANGLE_FACTOR 180
-
-
-/*-----=  Point Constructors & Destructors  =-----*/
-
-
-/**
- * @brief A Default Constructor for the Point, which create a new Point in the plane with
- *        the default coordinates.
- */
-Point::Point()
-{
-    _x = DEFAULT_COORDINATE_VALUE;
-    _y = DEFAULT_COORDINATE_VALUE;
-}
-
-/**
- * @brief A Constructor for the Point, which receive 2 coordinates and create a new Point in the
- *        plane with the given coordinates.
- * @param x The X coordinate in the plane.
- * @param y The Y coordinate in the plane.
- */
-Point::Point(int const x, int const y)
-{
-    _x = x;
-    _y = y;
-}
-
-/**
- * @brief A Destructor for the Point.
- */
-Point::~Point()
-{
-
-}
-
-
-/*-----=  Getters/Setters  =-----*/
-
-
-/**
- * @brief Sets the Point's coordinates to the given new values.
- * @param x The new X coordinate to set.
- * @param y The new Y coordinate to set.
- */
-void Point::set(int const x, int const y)
-{
-    _x = x;
-    _y = y;
-}
-
-
-/*-----=  Point Misc. Methods  =-----*/
-
-
-/**
- * @brief Represent the Point as a string for output use.
- * @return A string representation of the Point.
- */
-std::string Point::toString() const
-{
-    return std::to_string(getX()) + COORDINATES_SEPARATOR + std::to_string(getY());
-}
-
-/**
- * @brief Calculates the Polar Angle of this Point with respect to another given Point.
- * @param other The Point to calculate the Angle with.
- * @return The Polar Angle of the Points.
- */
-double Point::polarAngle(const Point& other) const
-{
-    double deltaX = this -> getX() - other.getX();
-    double deltaY = this -> getY() - other.getY();
-    return atan2(deltaY, deltaX) * ANGLE_FACTOR / PI;
-}
-
-/**
- * @brief Calculates the distance of this Point with respect to another given Point.
- * @param other The Point to calculate the distance with.
- * @return The distance of the Points.
- */
-double Point::distance(const Point &other) const
-{
-    double deltaX = this -> getX() - other.getX();
-    double deltaY = this -> getY() - other.getY();
-    return sqrt(deltaX*deltaX + deltaY*deltaY);
-}
-
-
-/*-----=  Point Operators Overload  =-----*/
-
-
-/**
- * @brief An operator overload for the comparison operator '==' which compares
- *        this Point with another given Point.
- * @param other A reference for the Point to compare to.
- * @return true if both the X coordinates and the Y coordinates are equal.
- */
-bool Point::operator==(const Point& other) const
-{
-    return (this -> getX() == other.getX()) && (this -> getY() == other.getY());
-}
+/**
+ * @file Point.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.7
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the Point Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the Point Class implementation.
+ * Define the Point Class methods and fields.
+ * A Point class is a single Point with X and Y coordinates in the plane.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cmath>
+#include "Point.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def DEFAULT_COORDINATE_VALUE 0
+ * @brief A Macro that sets the default value for a Point's coordinate.
+ */
+#define DEFAULT_COORDINATE_VALUE 0
+
+/**
+ * @def PI 3.14
+ * @brief A Macro that sets the value of the number Pi.
+ */
+#define PI 3.141592
+
+/**
+ * @def ANGLE_FACTOR 180
+ * @brief A Macro that sets the value for the factor calculating the Polar Angle.
+ */
+#define ANGLE_FACTOR 180
+
+/**
+ * @def HASH_SEED 0x9E3779B97F4A7C15
+ * @brief A Macro that sets the seed which separates the X and the Y coordinates in the hash.
+ */
+#define HASH_SEED 0x9E3779B97F4A7C15ULL
+
+
+/*-----=  Point Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Default Constructor for the Point, which create a new Point in the plane with
+ *        the default coordinates.
+ */
+Point::Point()
+{
+    _x = DEFAULT_COORDINATE_VALUE;
+    _y = DEFAULT_COORDINATE_VALUE;
+}
+
+/**
+ * @brief A Constructor for the Point, which receive 2 coordinates and create a new Point in the
+ *        plane with the given coordinates.
+ * @param x The X coordinate in the plane.
+ * @param y The Y coordinate in the plane.
+ */
+Point::Point(Coordinate const x, Coordinate const y)
+{
+    _x = x;
+    _y = y;
+}
+
+/**
+ * @brief A Destructor for the Point.
+ */
+Point::~Point()
+{
+
+}
+
+
+/*-----=  Getters/Setters  =-----*/
+
+
+/**
+ * @brief Sets the Point's coordinates to the given new values.
+ * @param x The new X coordinate to set.
+ * @param y The new Y coordinate to set.
+ */
+void Point::set(Coordinate const x, Coordinate const y)
+{
+    _x = x;
+    _y = y;
+}
+
+
+/*-----=  Point Misc. Methods  =-----*/
+
+
+/**
+ * @brief Represent the Point as a string for output use.
+ * @return A string representation of the Point.
+ */
+std::string Point::toString() const
+{
+    return std::to_string(getX()) + COORDINATES_SEPARATOR + std::to_string(getY());
+}
+
+/**
+ * @brief Calculates the Polar Angle of this Point with respect to another given Point.
+ * @param other The Point to calculate the Angle with.
+ * @return The Polar Angle of the Points.
+ */
+double Point::polarAngle(const Point& other) const
+{
+    double deltaX = (double) this -> getX() - other.getX();
+    double deltaY = (double) this -> getY() - other.getY();
+    return atan2(deltaY, deltaX) * ANGLE_FACTOR / PI;
+}
+
+/**
+ * @brief Calculates the distance of this Point with respect to another given Point.
+ * @param other The Point to calculate the distance with.
+ * @return The distance of the Points.
+ */
+double Point::distance(const Point &other) const
+{
+    double deltaX = (double) this -> getX() - other.getX();
+    double deltaY = (double) this -> getY() - other.getY();
+    return sqrt(deltaX*deltaX + deltaY*deltaY);
+}
+
+
+/**
+ * @brief Mix the bits of a given value, such that every input bit affects every output bit
+ *        (the finalizer of SplitMix64).
+ * @param value The value to mix.
+ * @return The mixed value.
+ */
+static uint64_t mixBits(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Calculates a well mixed 64 bits hash of the Point. Equal Points have equal hashes.
+ * @return The hash of the Point.
+ */
+uint64_t Point::hash() const
+{
+    return mixBits(mixBits(coordinateBits(getX()) + HASH_SEED) ^ coordinateBits(getY()));
+}
+
+
+/**
+ * @brief Spreads the bits of a given 32 bits value to the even bits of a 64 bits value, by moving
+ *        halves of decreasing size apart (16, 8, 4, 2 and then 1 bits).
+ * @param bits The value to spread.
+ * @return The spread value.
+ */
+static uint64_t spreadBits(uint32_t const bits)
+{
+    uint64_t spread = bits;
+    spread = (spread | (spread << 16)) & 0x0000FFFF0000FFFFULL;
+    spread = (spread | (spread << 8)) & 0x00FF00FF00FF00FFULL;
+    spread = (spread | (spread << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    spread = (spread | (spread << 2)) & 0x3333333333333333ULL;
+    return (spread | (spread << 1)) & 0x5555555555555555ULL;
+}
+
+/**
+ * @brief Calculates the Morton (Z-order) key of the Point, which interleaves the bits of the
+ *        ordered coordinates (X in the even bits and Y in the odd bits), so Points which are
+ *        close in the plane tend to have close keys.
+ * @return The Morton key of the Point.
+ */
+uint64_t Point::mortonKey() const
+{
+    return spreadBits(coordinateOrderBits(getX())) |
+           (spreadBits(coordinateOrderBits(getY())) << 1);
+}
+
+/**
+ * @brief Compares this Point with another Point by their Morton keys, and then by their X and
+ *        Y coordinates (the keys of wide coordinates keep only their high bits).
+ * @param other The Point to compare to.
+ * @return true if this Point is smaller than the other Point.
+ */
+bool Point::lessByMorton(const Point& other) const
+{
+    uint64_t key = mortonKey();
+    uint64_t otherKey = other.mortonKey();
+    return (key != otherKey) ? (key < otherKey) : lessByX(other);
+}
+
+
+/*-----=  Point Operators Overload  =-----*/
+
+
+/**
+ * @brief An operator overload for the comparison operator '==' which compares
+ *        this Point with another given Point.
+ * @param other A reference for the Point to compare to.
+ * @return true if both the X coordinates and the Y coordinates are equal.
+ */
+bool Point::operator==(const Point& other) const
+{
+    return (this -> getX() == other.getX()) && (this -> getY() == other.getY());
+}
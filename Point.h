@@ -1,124 +1,193 @@
-/**
- * @file Point.h
- * @author Itai Tagar <itagar>
- * @version 1.2
- * @date 04 Sep 2016
- *
- * @brief A Header File for the Point Class.
- *
- * @section LICENSE
- * This program is free to use in every operation system.
- *
- * @section DESCRIPTION
- * A Header File for the Point Class.
- * Declaring the Point Class, it's methods and fields.
- * A Point class is a single Point with X and Y coordinates in the plane.
- */
-
-
-#ifndef EX1_POINT_H
-#define EX1_POINT_H
-
-
-/*-----=  Includes  =-----*/
-
-
-#include <string>
-
-
-/*-----=  Definitions  =-----*/
-
-
-/**
- * @def COORDINATES_SEPARATOR ","
- * @brief A Macro that sets the output for the separator between the Point's coordinates.
- */
-#define COORDINATES_SEPARATOR ","
-
-
-/*-----=  Class Declaration  =-----*/
-
-
-/**
- * @brief A Class representing a single Point with X and Y coordinates.
- *        The Point holds it's coordinates in the plane, and several methods that operates these
- *        coordinates.
- */
-class Point
-{
-public:
-
-    /**
-     * @brief A Default Constructor for the Point, which create a new Point in the plane with
-     *        the default coordinates.
-     */
-    Point();
-
-    /**
-     * @brief A Constructor for the Point, which receive 2 coordinates and create a new Point in the
-     *        plane with the given coordinates.
-     * @param x The X coordinate in the plane.
-     * @param y The Y coordinate in the plane.
-     */
-    Point(int const x, int const y);
-
-    /**
-     * @brief A Destructor for the Point.
-     */
-    ~Point();
-
-    /**
-     * @brief Returns the X coordinate value.
-     * @return The X coordinate value.
-     */
-    int getX() const { return _x; };
-
-    /**
-     * @brief Returns the Y coordinate value.
-     * @return The Y coordinate value.
-     */
-    int getY() const { return _y; };
-
-    /**
-     * @brief Sets the Point's coordinates to the given new values.
-     * @param x The new X coordinate to set.
-     * @param y The new Y coordinate to set.
-     */
-    void set(int const x, int const y);
-
-    /**
-     * @brief Represent the Point as a string for output use.
-     * @return A string representation of the Point.
-     */
-    std::string toString() const;
-
-    /**
-     * @brief Calculates the Polar Angle of this Point with respect to another given Point.
-     * @param other The Point to calculate the Angle with.
-     * @return The Polar Angle of the Points.
-     */
-    double polarAngle(const Point& other) const;
-
-    /**
-     * @brief Calculates the distance of this Point with respect to another given Point.
-     * @param other The Point to calculate the distance with.
-     * @return The distance of the Points.
-     */
-    double distance(const Point& other) const;
-
-    /**
-     * @brief An operator overload for the comparison operator '==' which compares
-     *        this Point with another given Point.
-     * @param other A reference for the Point to compare to.
-     * @return true if both the X coordinates and the Y coordinates are equal.
-     */
-    bool operator==(const Point& other) const;
-
-private:
-    // Point Private Fields.
-    int _x;  // The X coordinate value for the Point.
-    int _y;  // The Y coordinate value for the Point.
-};
-
-
-#endif //EX1_POINT_H
+/**
+ * @file Point.h
+ * @author Itai Tagar <itagar>
+ * @version 1.2
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the Point Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Point Class.
+ * Declaring the Point Class, it's methods and fields.
+ * A Point class is a single Point with X and Y coordinates in the plane.
+ */
+
+
+#ifndef EX1_POINT_H
+#define EX1_POINT_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <string>
+#include "Coordinate.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def COORDINATES_SEPARATOR ","
+ * @brief A Macro that sets the output for the separator between the Point's coordinates.
+ */
+#define COORDINATES_SEPARATOR ","
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a single Point with X and Y coordinates.
+ *        The Point holds it's coordinates in the plane, and several methods that operates these
+ *        coordinates.
+ */
+class Point
+{
+public:
+
+    /**
+     * @brief A Default Constructor for the Point, which create a new Point in the plane with
+     *        the default coordinates.
+     */
+    Point();
+
+    /**
+     * @brief A Constructor for the Point, which receive 2 coordinates and create a new Point in the
+     *        plane with the given coordinates.
+     * @param x The X coordinate in the plane.
+     * @param y The Y coordinate in the plane.
+     */
+    Point(Coordinate const x, Coordinate const y);
+
+    /**
+     * @brief A Destructor for the Point.
+     */
+    ~Point();
+
+    /**
+     * @brief Returns the X coordinate value.
+     * @return The X coordinate value.
+     */
+    Coordinate getX() const { return _x; };
+
+    /**
+     * @brief Returns the Y coordinate value.
+     * @return The Y coordinate value.
+     */
+    Coordinate getY() const { return _y; };
+
+    /**
+     * @brief Sets the Point's coordinates to the given new values.
+     * @param x The new X coordinate to set.
+     * @param y The new Y coordinate to set.
+     */
+    void set(Coordinate const x, Coordinate const y);
+
+    /**
+     * @brief Represent the Point as a string for output use.
+     * @return A string representation of the Point.
+     */
+    std::string toString() const;
+
+    /**
+     * @brief Calculates the Polar Angle of this Point with respect to another given Point.
+     * @param other The Point to calculate the Angle with.
+     * @return The Polar Angle of the Points.
+     */
+    double polarAngle(const Point& other) const;
+
+    /**
+     * @brief Calculates the distance of this Point with respect to another given Point.
+     * @param other The Point to calculate the distance with.
+     * @return The distance of the Points.
+     */
+    double distance(const Point& other) const;
+
+    /**
+     * @brief Calculates the exact squared distance of this Point with respect to another Point.
+     * @param other The Point to calculate the distance with.
+     * @return The squared distance of the Points.
+     */
+    CoordinateProduct squaredDistance(const Point& other) const
+    {
+        return ::squaredDistance(_x, _y, other._x, other._y);
+    };
+
+    /**
+     * @brief Calculates the exact orientation of the turn from this Point to the Point B and then
+     *        to the Point C.
+     * @param pointB The second Point of the turn.
+     * @param pointC The third Point of the turn.
+     * @return 1 for a Counter-Clockwise turn, -1 for a Clockwise turn and 0 if the Points are
+     *         collinear.
+     */
+    int orientation(const Point& pointB, const Point& pointC) const
+    {
+        CoordinateProduct cross = crossProduct(_x, _y, pointB._x, pointB._y, pointC._x, pointC._y);
+        return (cross > 0) - (cross < 0);
+    };
+
+    /**
+     * @brief Compares this Point with another Point by their X coordinates, and then by their Y
+     *        coordinates.
+     * @param other The Point to compare to.
+     * @return true if this Point is smaller than the other Point.
+     */
+    bool lessByX(const Point& other) const
+    {
+        return CoordinateTraits<Coordinate>::lexicographicLess(_x, _y, other._x, other._y);
+    };
+
+    /**
+     * @brief Compares this Point with another Point by their Y coordinates, and then by their X
+     *        coordinates.
+     * @param other The Point to compare to.
+     * @return true if this Point is smaller than the other Point.
+     */
+    bool lessByY(const Point& other) const
+    {
+        return CoordinateTraits<Coordinate>::lexicographicLess(_y, _x, other._y, other._x);
+    };
+
+    /**
+     * @brief Calculates a well mixed 64 bits hash of the Point. Equal Points have equal hashes.
+     * @return The hash of the Point.
+     */
+    uint64_t hash() const;
+
+    /**
+     * @brief Calculates the Morton (Z-order) key of the Point, which interleaves the bits of the
+     *        ordered coordinates (X in the even bits and Y in the odd bits), so Points which are
+     *        close in the plane tend to have close keys.
+     * @return The Morton key of the Point.
+     */
+    uint64_t mortonKey() const;
+
+    /**
+     * @brief Compares this Point with another Point by their Morton keys, and then by their X and
+     *        Y coordinates (the keys of wide coordinates keep only their high bits).
+     * @param other The Point to compare to.
+     * @return true if this Point is smaller than the other Point.
+     */
+    bool lessByMorton(const Point& other) const;
+
+    /**
+     * @brief An operator overload for the comparison operator '==' which compares
+     *        this Point with another given Point.
+     * @param other A reference for the Point to compare to.
+     * @return true if both the X coordinates and the Y coordinates are equal.
+     */
+    bool operator==(const Point& other) const;
+
+private:
+    // Point Private Fields.
+    Coordinate _x;  // The X coordinate value for the Point.
+    Coordinate _y;  // The Y coordinate value for the Point.
+};
+
+
+#endif //EX1_POINT_H
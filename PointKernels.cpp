@@ -0,0 +1,698 @@
+/**
+ * @file PointKernels.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the bulk kernels over contiguous arrays of Points implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the bulk kernels over contiguous arrays of Points implementation.
+ * A Point with 32 bits coordinates is packed in 64 bits (X in the low half and Y in the high
+ * half), so the vectorised kernels handle each Point as a single 64 bits lane:
+ *     Finding a Point compares whole lanes with the packed Point.
+ *     Finding an extreme Point turns each lane to a 64 bits key which is ordered like the Points
+ *     (the low half is biased, and the halves are swapped for the X order), and keeps the minimum.
+ *     The orientation subtracts the packed edge start from each lane and multiplies the 32 bits
+ *     differences to 64 bits products. This is exact when all the coordinates are below 2^30 in
+ *     absolute value, so blocks with larger coordinates are handled by the scalar kernel.
+ * The kernels are selected once, by the features of the processor.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cstring>
+#include "PointKernels.h"
+
+#if !defined(SCALAR_KERNELS) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) \
+    && !defined(COORDINATE_INT16) && !defined(COORDINATE_INT64) && !defined(COORDINATE_DOUBLE)
+#define VECTOR_KERNELS
+#include <immintrin.h>
+#endif
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def AVX2_POINTS 4
+ * @brief A Macro that sets the number of packed Points in an AVX2 register.
+ */
+#define AVX2_POINTS 4
+
+/**
+ * @def SSE_POINTS 2
+ * @brief A Macro that sets the number of packed Points in an SSE register.
+ */
+#define SSE_POINTS 2
+
+/**
+ * @def EXACT_COORDINATE_BOUND 0x40000000
+ * @brief A Macro that sets the bound (exclusive) of the absolute value of the coordinates for the
+ *        vectorised orientation, in which the differences fit in 32 bits and the cross product
+ *        fits in 64 bits.
+ */
+#define EXACT_COORDINATE_BOUND 0x40000000
+
+/**
+ * @def MORTON_SEARCH_MINIMUM_SIZE 32
+ * @brief A Macro that sets the minimal number of Points for which a Point is found in Morton order
+ *        by a binary search instead of the linear kernel.
+ */
+#define MORTON_SEARCH_MINIMUM_SIZE 32
+
+/**
+ * @def LOW_HALF_BIAS 0x80000000
+ * @brief A Macro that sets the bias which turns the signed low half of a packed Point into an
+ *        unsigned value with the same order.
+ */
+#define LOW_HALF_BIAS 0x80000000LL
+
+/**
+ * @def TURN_SIZE 2
+ * @brief A Macro that sets the number of Hull Points which a new Point is checked to turn with.
+ */
+#define TURN_SIZE 2
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A kernel which finds a Point in an array of Points.
+ */
+typedef int (*FindPointKernel)(const Point *, int, const Point&);
+
+/**
+ * @brief A kernel which finds an extreme Point in an array of Points.
+ */
+typedef int (*FindExtremeKernel)(const Point *, int, ExtremePoint);
+
+/**
+ * @brief A kernel which calculates the orientation of an array of Points with respect to an edge.
+ */
+typedef void (*OrientationKernel)(const Point&, const Point&, const Point *, int, signed char *);
+
+/**
+ * @brief The set of kernels selected for the current processor.
+ */
+struct KernelTable
+{
+    FindPointKernel findPoint;  // The kernel for findPointIndex.
+    FindExtremeKernel findExtreme;  // The kernel for findExtremeIndex.
+    OrientationKernel orientation;  // The kernel for orientationSigns.
+};
+
+
+/*-----=  Scalar Kernels  =-----*/
+
+
+/**
+ * @brief Finds the given Point in the given range of Points, one Point at a time.
+ * @param points The array of Points.
+ * @param start The index to start from (inclusive).
+ * @param count The number of Points in the array.
+ * @param point The Point to find.
+ * @return The index of the first occurrence of the Point, or POINT_NOT_FOUND.
+ */
+static int scalarFindFrom(const Point *points, int const start, int const count,
+                          const Point& point)
+{
+    for (int i = start; i < count; i++)
+    {
+        if (points[i] == point)
+        {
+            return i;
+        }
+    }
+    return POINT_NOT_FOUND;
+}
+
+/**
+ * @brief Finds the given Point in the given array of Points, one Point at a time.
+ */
+static int scalarFindPoint(const Point *points, int const count, const Point& point)
+{
+    return scalarFindFrom(points, 0, count, point);
+}
+
+/**
+ * @brief Checks if the first Point is more extreme than the second Point in the given kind.
+ * @param point1 The first Point.
+ * @param point2 The second Point.
+ * @param kind The kind of the extreme Point.
+ * @return true if the first Point is more extreme.
+ */
+bool moreExtreme(const Point& point1, const Point& point2, ExtremePoint const kind)
+{
+    switch (kind)
+    {
+        case LOWEST_POINT:
+            return point1.lessByY(point2);
+        case HIGHEST_POINT:
+            return point2.lessByY(point1);
+        case LEFTMOST_POINT:
+            return point1.lessByX(point2);
+        default:
+            return point2.lessByX(point1);
+    }
+}
+
+/**
+ * @brief Finds the extreme Point of the given kind, one Point at a time.
+ */
+static int scalarFindExtreme(const Point *points, int const count, ExtremePoint const kind)
+{
+    int best = 0;
+    for (int i = 1; i < count; i++)
+    {
+        if (moreExtreme(points[i], points[best], kind))
+        {
+            best = i;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Calculates the orientation of the given range of Points, one Point at a time.
+ * @param edgeStart The start of the edge.
+ * @param edgeEnd The end of the edge.
+ * @param points The array of Points.
+ * @param start The index to start from (inclusive).
+ * @param end The index to end at (exclusive).
+ * @param signs The output array.
+ */
+static void scalarOrientationRange(const Point& edgeStart, const Point& edgeEnd,
+                                   const Point *points, int const start, int const end,
+                                   signed char *signs)
+{
+    for (int i = start; i < end; i++)
+    {
+        signs[i] = (signed char) edgeStart.orientation(edgeEnd, points[i]);
+    }
+}
+
+/**
+ * @brief Calculates the orientation of the given array of Points, one Point at a time.
+ */
+static void scalarOrientationSigns(const Point& edgeStart, const Point& edgeEnd,
+                                   const Point *points, int const count, signed char *signs)
+{
+    scalarOrientationRange(edgeStart, edgeEnd, points, 0, count, signs);
+}
+
+
+#ifdef VECTOR_KERNELS
+
+
+/*-----=  Vector Kernels Helpers  =-----*/
+
+
+/**
+ * @brief Packs a Point to a single 64 bits value, as it is stored in memory.
+ * @param point The Point to pack.
+ * @return The packed Point.
+ */
+static long long packPoint(const Point& point)
+{
+    long long packed = 0;
+    memcpy(&packed, &point, sizeof(packed));
+    return packed;
+}
+
+/**
+ * @brief Calculates the key of a packed Point, such that the most extreme Point of the given kind
+ *        has the minimal key.
+ * @param packed The packed Point.
+ * @param kind The kind of the extreme Point.
+ * @return The key of the Point.
+ */
+static long long extremeKey(long long const packed, ExtremePoint const kind)
+{
+    unsigned long long value = (unsigned long long) packed;
+    if ((kind == LEFTMOST_POINT) || (kind == RIGHTMOST_POINT))
+    {
+        value = (value << 32) | (value >> 32);
+    }
+    long long key = (long long) (value ^ LOW_HALF_BIAS);
+    return ((kind == HIGHEST_POINT) || (kind == RIGHTMOST_POINT)) ? ~key : key;
+}
+
+/**
+ * @brief Checks if a given Point is within the bound of the exact vectorised orientation.
+ * @param point The Point to check.
+ * @return true if both coordinates are within the bound.
+ */
+static bool withinExactBound(const Point& point)
+{
+    return (point.getX() > -EXACT_COORDINATE_BOUND) && (point.getX() < EXACT_COORDINATE_BOUND) &&
+           (point.getY() > -EXACT_COORDINATE_BOUND) && (point.getY() < EXACT_COORDINATE_BOUND);
+}
+
+/**
+ * @brief Reduce the candidate lanes of the vectorised extreme search and the remaining Points to
+ *        a single extreme Point.
+ * @param points The array of Points.
+ * @param count The number of Points in the array.
+ * @param start The index of the first remaining Point.
+ * @param keys The keys of the candidates.
+ * @param indices The indices of the candidates.
+ * @param lanes The number of candidates.
+ * @param kind The kind of the extreme Point.
+ * @return The index of the extreme Point.
+ */
+static int reduceExtreme(const Point *points, int const count, int const start,
+                         const long long *keys, const long long *indices, int const lanes,
+                         ExtremePoint const kind)
+{
+    long long bestKey = keys[0];
+    int best = (int) indices[0];
+    for (int lane = 1; lane < lanes; lane++)
+    {
+        if (keys[lane] < bestKey)
+        {
+            bestKey = keys[lane];
+            best = (int) indices[lane];
+        }
+    }
+    for (int i = start; i < count; i++)
+    {
+        long long key = extremeKey(packPoint(points[i]), kind);
+        if (key < bestKey)
+        {
+            bestKey = key;
+            best = i;
+        }
+    }
+    return best;
+}
+
+
+/*-----=  AVX2 Kernels  =-----*/
+
+
+/**
+ * @brief Finds the given Point in the given array of Points, 8 Points at a time.
+ */
+__attribute__((target("avx2")))
+static int avx2FindPoint(const Point *points, int const count, const Point& point)
+{
+    const __m256i *data = reinterpret_cast<const __m256i *>(points);
+    __m256i needle = _mm256_set1_epi64x(packPoint(point));
+    int i = 0;
+    for ( ; (i + 2 * AVX2_POINTS) <= count; i += 2 * AVX2_POINTS)
+    {
+        __m256i first = _mm256_cmpeq_epi64(_mm256_loadu_si256(data + i / AVX2_POINTS), needle);
+        __m256i second = _mm256_cmpeq_epi64(_mm256_loadu_si256(data + i / AVX2_POINTS + 1),
+                                            needle);
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(first)) |
+                   (_mm256_movemask_pd(_mm256_castsi256_pd(second)) << AVX2_POINTS);
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return scalarFindFrom(points, i, count, point);
+}
+
+/**
+ * @brief Turns a block of packed Points to their extreme keys.
+ */
+__attribute__((target("avx2")))
+static __m256i avx2ExtremeKeys(__m256i block, ExtremePoint const kind)
+{
+    if ((kind == LEFTMOST_POINT) || (kind == RIGHTMOST_POINT))
+    {
+        block = _mm256_shuffle_epi32(block, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    block = _mm256_xor_si256(block, _mm256_set1_epi64x(LOW_HALF_BIAS));
+    if ((kind == HIGHEST_POINT) || (kind == RIGHTMOST_POINT))
+    {
+        block = _mm256_xor_si256(block, _mm256_set1_epi64x(-1));
+    }
+    return block;
+}
+
+/**
+ * @brief Finds the extreme Point of the given kind, 4 Points at a time.
+ */
+__attribute__((target("avx2")))
+static int avx2FindExtreme(const Point *points, int const count, ExtremePoint const kind)
+{
+    if (count < AVX2_POINTS)
+    {
+        return scalarFindExtreme(points, count, kind);
+    }
+
+    const __m256i *data = reinterpret_cast<const __m256i *>(points);
+    __m256i bestKeys = avx2ExtremeKeys(_mm256_loadu_si256(data), kind);
+    __m256i bestIndices = _mm256_set_epi64x(3, 2, 1, 0);
+    __m256i indices = bestIndices;
+    __m256i step = _mm256_set1_epi64x(AVX2_POINTS);
+    int i = AVX2_POINTS;
+    for ( ; (i + AVX2_POINTS) <= count; i += AVX2_POINTS)
+    {
+        indices = _mm256_add_epi64(indices, step);
+        __m256i keys = avx2ExtremeKeys(_mm256_loadu_si256(data + i / AVX2_POINTS), kind);
+        __m256i better = _mm256_cmpgt_epi64(bestKeys, keys);
+        bestKeys = _mm256_blendv_epi8(bestKeys, keys, better);
+        bestIndices = _mm256_blendv_epi8(bestIndices, indices, better);
+    }
+
+    long long keys[AVX2_POINTS];
+    long long candidates[AVX2_POINTS];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(keys), bestKeys);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(candidates), bestIndices);
+    return reduceExtreme(points, count, i, keys, candidates, AVX2_POINTS, kind);
+}
+
+/**
+ * @brief Calculates the orientation of the given array of Points, 4 Points at a time.
+ */
+__attribute__((target("avx2")))
+static void avx2OrientationSigns(const Point& edgeStart, const Point& edgeEnd,
+                                 const Point *points, int const count, signed char *signs)
+{
+    if (!withinExactBound(edgeStart) || !withinExactBound(edgeEnd))
+    {
+        scalarOrientationSigns(edgeStart, edgeEnd, points, count, signs);
+        return;
+    }
+
+    const __m256i *data = reinterpret_cast<const __m256i *>(points);
+    __m256i origin = _mm256_set1_epi64x(packPoint(edgeStart));
+    __m256i edgeX = _mm256_set1_epi64x((long long) edgeEnd.getX() - edgeStart.getX());
+    __m256i edgeY = _mm256_set1_epi64x((long long) edgeEnd.getY() - edgeStart.getY());
+    __m256i lowBound = _mm256_set1_epi32(-EXACT_COORDINATE_BOUND);
+    __m256i highBound = _mm256_set1_epi32(EXACT_COORDINATE_BOUND);
+    __m256i zero = _mm256_setzero_si256();
+    int i = 0;
+    for ( ; (i + AVX2_POINTS) <= count; i += AVX2_POINTS)
+    {
+        __m256i block = _mm256_loadu_si256(data + i / AVX2_POINTS);
+        __m256i inRange = _mm256_and_si256(_mm256_cmpgt_epi32(block, lowBound),
+                                           _mm256_cmpgt_epi32(highBound, block));
+        if (_mm256_movemask_epi8(inRange) != -1)
+        {
+            scalarOrientationRange(edgeStart, edgeEnd, points, i, i + AVX2_POINTS, signs);
+            continue;
+        }
+
+        // Each lane holds (dx, dy) of the Point from the edge start.
+        __m256i delta = _mm256_sub_epi32(block, origin);
+        __m256i turn = _mm256_sub_epi64(_mm256_mul_epi32(_mm256_srli_epi64(delta, 32), edgeX),
+                                        _mm256_mul_epi32(delta, edgeY));
+        int positive = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(turn, zero)));
+        int negative = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(zero, turn)));
+        for (int lane = 0; lane < AVX2_POINTS; lane++)
+        {
+            signs[i + lane] = (signed char) (((positive >> lane) & 1) - ((negative >> lane) & 1));
+        }
+    }
+    scalarOrientationRange(edgeStart, edgeEnd, points, i, count, signs);
+}
+
+
+/*-----=  SSE4.2 Kernels  =-----*/
+
+
+/**
+ * @brief Finds the given Point in the given array of Points, 2 Points at a time.
+ */
+__attribute__((target("sse4.2")))
+static int sseFindPoint(const Point *points, int const count, const Point& point)
+{
+    const __m128i *data = reinterpret_cast<const __m128i *>(points);
+    __m128i needle = _mm_set1_epi64x(packPoint(point));
+    int i = 0;
+    for ( ; (i + SSE_POINTS) <= count; i += SSE_POINTS)
+    {
+        __m128i equal = _mm_cmpeq_epi64(_mm_loadu_si128(data + i / SSE_POINTS), needle);
+        int mask = _mm_movemask_pd(_mm_castsi128_pd(equal));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return scalarFindFrom(points, i, count, point);
+}
+
+/**
+ * @brief Turns a block of packed Points to their extreme keys.
+ */
+__attribute__((target("sse4.2")))
+static __m128i sseExtremeKeys(__m128i block, ExtremePoint const kind)
+{
+    if ((kind == LEFTMOST_POINT) || (kind == RIGHTMOST_POINT))
+    {
+        block = _mm_shuffle_epi32(block, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    block = _mm_xor_si128(block, _mm_set1_epi64x(LOW_HALF_BIAS));
+    if ((kind == HIGHEST_POINT) || (kind == RIGHTMOST_POINT))
+    {
+        block = _mm_xor_si128(block, _mm_set1_epi64x(-1));
+    }
+    return block;
+}
+
+/**
+ * @brief Finds the extreme Point of the given kind, 2 Points at a time.
+ */
+__attribute__((target("sse4.2")))
+static int sseFindExtreme(const Point *points, int const count, ExtremePoint const kind)
+{
+    if (count < SSE_POINTS)
+    {
+        return scalarFindExtreme(points, count, kind);
+    }
+
+    const __m128i *data = reinterpret_cast<const __m128i *>(points);
+    __m128i bestKeys = sseExtremeKeys(_mm_loadu_si128(data), kind);
+    __m128i bestIndices = _mm_set_epi64x(1, 0);
+    __m128i indices = bestIndices;
+    __m128i step = _mm_set1_epi64x(SSE_POINTS);
+    int i = SSE_POINTS;
+    for ( ; (i + SSE_POINTS) <= count; i += SSE_POINTS)
+    {
+        indices = _mm_add_epi64(indices, step);
+        __m128i keys = sseExtremeKeys(_mm_loadu_si128(data + i / SSE_POINTS), kind);
+        __m128i better = _mm_cmpgt_epi64(bestKeys, keys);
+        bestKeys = _mm_blendv_epi8(bestKeys, keys, better);
+        bestIndices = _mm_blendv_epi8(bestIndices, indices, better);
+    }
+
+    long long keys[SSE_POINTS];
+    long long candidates[SSE_POINTS];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(keys), bestKeys);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(candidates), bestIndices);
+    return reduceExtreme(points, count, i, keys, candidates, SSE_POINTS, kind);
+}
+
+/**
+ * @brief Calculates the orientation of the given array of Points, 2 Points at a time.
+ */
+__attribute__((target("sse4.2")))
+static void sseOrientationSigns(const Point& edgeStart, const Point& edgeEnd,
+                                const Point *points, int const count, signed char *signs)
+{
+    if (!withinExactBound(edgeStart) || !withinExactBound(edgeEnd))
+    {
+        scalarOrientationSigns(edgeStart, edgeEnd, points, count, signs);
+        return;
+    }
+
+    const __m128i *data = reinterpret_cast<const __m128i *>(points);
+    __m128i origin = _mm_set1_epi64x(packPoint(edgeStart));
+    __m128i edgeX = _mm_set1_epi64x((long long) edgeEnd.getX() - edgeStart.getX());
+    __m128i edgeY = _mm_set1_epi64x((long long) edgeEnd.getY() - edgeStart.getY());
+    __m128i lowBound = _mm_set1_epi32(-EXACT_COORDINATE_BOUND);
+    __m128i highBound = _mm_set1_epi32(EXACT_COORDINATE_BOUND);
+    __m128i zero = _mm_setzero_si128();
+    int i = 0;
+    for ( ; (i + SSE_POINTS) <= count; i += SSE_POINTS)
+    {
+        __m128i block = _mm_loadu_si128(data + i / SSE_POINTS);
+        __m128i inRange = _mm_and_si128(_mm_cmpgt_epi32(block, lowBound),
+                                        _mm_cmpgt_epi32(highBound, block));
+        if (_mm_movemask_epi8(inRange) != 0xFFFF)
+        {
+            scalarOrientationRange(edgeStart, edgeEnd, points, i, i + SSE_POINTS, signs);
+            continue;
+        }
+
+        // Each lane holds (dx, dy) of the Point from the edge start.
+        __m128i delta = _mm_sub_epi32(block, origin);
+        __m128i turn = _mm_sub_epi64(_mm_mul_epi32(_mm_srli_epi64(delta, 32), edgeX),
+                                     _mm_mul_epi32(delta, edgeY));
+        int positive = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(turn, zero)));
+        int negative = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(zero, turn)));
+        for (int lane = 0; lane < SSE_POINTS; lane++)
+        {
+            signs[i + lane] = (signed char) (((positive >> lane) & 1) - ((negative >> lane) & 1));
+        }
+    }
+    scalarOrientationRange(edgeStart, edgeEnd, points, i, count, signs);
+}
+
+
+#endif //VECTOR_KERNELS
+
+
+/*-----=  Kernels Dispatch  =-----*/
+
+
+/**
+ * @brief Selects the best kernels for the current processor.
+ * @return The selected kernels.
+ */
+static KernelTable selectKernels()
+{
+    KernelTable table = {scalarFindPoint, scalarFindExtreme, scalarOrientationSigns};
+#ifdef VECTOR_KERNELS
+    static_assert(sizeof(Point) == sizeof(long long), "A Point must be packed in 64 bits");
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        table.findPoint = avx2FindPoint;
+        table.findExtreme = avx2FindExtreme;
+        table.orientation = avx2OrientationSigns;
+    }
+    else if (__builtin_cpu_supports("sse4.2"))
+    {
+        table.findPoint = sseFindPoint;
+        table.findExtreme = sseFindExtreme;
+        table.orientation = sseOrientationSigns;
+    }
+#endif
+    return table;
+}
+
+/**
+ * @brief Returns the kernels for the current processor, which are selected on the first call.
+ * @return The selected kernels.
+ */
+static const KernelTable& kernels()
+{
+    static const KernelTable table = selectKernels();
+    return table;
+}
+
+
+/*-----=  Point Kernels  =-----*/
+
+
+/**
+ * @brief Finds the given Point in the given array of Points.
+ * @param points The array of Points.
+ * @param count The number of Points in the array.
+ * @param point The Point to find.
+ * @return The index of the first occurrence of the Point, or POINT_NOT_FOUND.
+ */
+int findPointIndex(const Point *points, int const count, const Point& point)
+{
+    return kernels().findPoint(points, count, point);
+}
+
+/**
+ * @brief Finds the given Point in the given array of distinct Points, which are sorted in Morton
+ *        order (by Point::lessByMorton), with a binary search. The key of the Point is calculated
+ *        once, and a small array is scanned by the linear kernel.
+ * @param points The sorted array of Points.
+ * @param count The number of Points in the array.
+ * @param point The Point to find.
+ * @return The index of the Point, or POINT_NOT_FOUND.
+ */
+int findMortonIndex(const Point *points, int const count, const Point& point)
+{
+    if (count < MORTON_SEARCH_MINIMUM_SIZE)
+    {
+        return findPointIndex(points, count, point);
+    }
+    uint64_t key = point.mortonKey();
+    const Point *found = std::lower_bound(points, points + count, point,
+                                          [key](const Point& current, const Point& target)
+                                          {
+                                              uint64_t currentKey = current.mortonKey();
+                                              return (currentKey != key) ? (currentKey < key) :
+                                                     current.lessByX(target);
+                                          });
+    return ((found != points + count) && (*found == point)) ? (int) (found - points) :
+           POINT_NOT_FOUND;
+}
+
+/**
+ * @brief Finds the extreme Point of the given kind in the given array of Points.
+ * @param points The array of Points.
+ * @param count The number of Points in the array, which must be positive.
+ * @param kind The kind of the extreme Point.
+ * @return The index of the extreme Point.
+ */
+int findExtremeIndex(const Point *points, int const count, ExtremePoint const kind)
+{
+    return kernels().findExtreme(points, count, kind);
+}
+
+/**
+ * @brief Calculates the orientation of each Point in the given array with respect to the directed
+ *        line from the edge start to the edge end.
+ * @param edgeStart The start of the edge.
+ * @param edgeEnd The end of the edge.
+ * @param points The array of Points.
+ * @param count The number of Points in the array.
+ * @param signs The output array, which receives for each Point 1 for a Counter-Clockwise turn,
+ *        -1 for a Clockwise turn and 0 if the Point is collinear with the edge.
+ */
+void orientationSigns(const Point& edgeStart, const Point& edgeEnd, const Point *points,
+                      int const count, signed char *signs)
+{
+    kernels().orientation(edgeStart, edgeEnd, points, count, signs);
+}
+
+/**
+ * @brief Calculate the Convex Hull of the given distinct Points, which are sorted by their X and
+ *        then Y coordinates, with the Monotone Chain in O(n).
+ * @param points The sorted array of distinct Points.
+ * @param count The number of Points in the array.
+ * @param hull The output array for the Hull in Counter-Clockwise order, starting from the leftmost
+ *        Point. It must have room for 2 * count Points.
+ * @return The number of Points in the Hull.
+ */
+int monotoneChain(const Point *points, int const count, Point *hull)
+{
+    int size = 0;
+
+    // The lower Hull, from the leftmost Point to the rightmost Point.
+    for (int i = 0; i < count; i++)
+    {
+        while ((size >= TURN_SIZE) && (hull[size - 2].orientation(hull[size - 1], points[i]) <= 0))
+        {
+            size--;
+        }
+        hull[size++] = points[i];
+    }
+
+    // The upper Hull, from the rightmost Point back to the leftmost Point.
+    int lowerSize = size;
+    for (int i = count - 2; i >= 0; i--)
+    {
+        while ((size > lowerSize) && (hull[size - 2].orientation(hull[size - 1], points[i]) <= 0))
+        {
+            size--;
+        }
+        hull[size++] = points[i];
+    }
+
+    // The leftmost Point closes the upper Hull, and it is already the start of the lower Hull.
+    if (count > 1)
+    {
+        size--;
+    }
+    return size;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file PointKernels.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the bulk kernels over contiguous arrays of Points.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the bulk kernels over contiguous arrays of Points.
+ * Declaring the kernels which scan many Points at once: finding a Point, finding an extreme Point
+ * and calculating the orientation of many Points with respect to a single edge.
+ * For 32 bits coordinates the kernels are vectorised with AVX2 or SSE4.2, selected at runtime by
+ * the features of the processor, with a scalar fallback. Defining SCALAR_KERNELS at compile time
+ * disables the vectorised kernels.
+ */
+
+
+#ifndef EX1_POINTKERNELS_H
+#define EX1_POINTKERNELS_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "Point.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def POINT_NOT_FOUND -1
+ * @brief A Macro that sets the index returned when a Point is not found.
+ */
+#define POINT_NOT_FOUND -1
+
+/**
+ * @def EXTREME_POINT_KINDS 4
+ * @brief A Macro that sets the number of kinds of extreme Points.
+ */
+#define EXTREME_POINT_KINDS 4
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The kinds of extreme Points. Ties are broken by the other coordinate, in the same
+ *        direction (e.g. the lowest Point is the leftmost among the Points with the minimal Y).
+ */
+enum ExtremePoint
+{
+    LOWEST_POINT,
+    HIGHEST_POINT,
+    LEFTMOST_POINT,
+    RIGHTMOST_POINT
+};
+
+
+/*-----=  Point Kernels  =-----*/
+
+
+/**
+ * @brief Finds the given Point in the given array of Points.
+ * @param points The array of Points.
+ * @param count The number of Points in the array.
+ * @param point The Point to find.
+ * @return The index of the first occurrence of the Point, or POINT_NOT_FOUND.
+ */
+int findPointIndex(const Point *points, int const count, const Point& point);
+
+/**
+ * @brief Finds the given Point in the given array of distinct Points, which are sorted in Morton
+ *        order (by Point::lessByMorton), with a binary search.
+ * @param points The sorted array of Points.
+ * @param count The number of Points in the array.
+ * @param point The Point to find.
+ * @return The index of the Point, or POINT_NOT_FOUND.
+ */
+int findMortonIndex(const Point *points, int const count, const Point& point);
+
+/**
+ * @brief Finds the extreme Point of the given kind in the given array of Points.
+ * @param points The array of Points.
+ * @param count The number of Points in the array, which must be positive.
+ * @param kind The kind of the extreme Point.
+ * @return The index of the extreme Point.
+ */
+int findExtremeIndex(const Point *points, int const count, ExtremePoint const kind);
+
+/**
+ * @brief Checks if the first Point is more extreme than the second Point in the given kind.
+ * @param point1 The first Point.
+ * @param point2 The second Point.
+ * @param kind The kind of the extreme Point.
+ * @return true if the first Point is more extreme.
+ */
+bool moreExtreme(const Point& point1, const Point& point2, ExtremePoint const kind);
+
+/**
+ * @brief Calculates the orientation of each Point in the given array with respect to the directed
+ *        line from the edge start to the edge end.
+ * @param edgeStart The start of the edge.
+ * @param edgeEnd The end of the edge.
+ * @param points The array of Points.
+ * @param count The number of Points in the array.
+ * @param signs The output array, which receives for each Point 1 for a Counter-Clockwise turn,
+ *        -1 for a Clockwise turn and 0 if the Point is collinear with the edge.
+ */
+void orientationSigns(const Point& edgeStart, const Point& edgeEnd, const Point *points,
+                      int const count, signed char *signs);
+
+/**
+ * @brief Calculate the Convex Hull of the given distinct Points, which are sorted by their X and
+ *        then Y coordinates, with the Monotone Chain in O(n).
+ * @param points The sorted array of distinct Points.
+ * @param count The number of Points in the array.
+ * @param hull The output array for the Hull in Counter-Clockwise order, starting from the leftmost
+ *        Point. It must have room for 2 * count Points.
+ * @return The number of Points in the Hull.
+ */
+int monotoneChain(const Point *points, int const count, Point *hull);
+
+
+#endif //EX1_POINTKERNELS_H
@@ -1,499 +1,1120 @@
-/**
- * @file PointSet.cpp
- * @author Itai Tagar <itagar>
- * @version 2.5
- * @date 04 Sep 2016
- *
- * @brief A File for the PointSet Class implementation.
- *
- * @section LICENSE
- * This program is free to use in every operation system.
- *
- * @section DESCRIPTION
- * A File for the PointSet Class implementation.
- * Define the PointSet Class methods and fields.
- * A PointSet class is a Set which holds Points and allows several operations associated with a Set.
- */
-
-
-/*-----=  Includes  =-----*/
-
-
-#include <algorithm>
-#include <cassert>
-#include "PointSet.h"
-
-
-/*-----=  Definitions  =-----*/
-
-
-/**
- * @def EMPTY_SET_SIZE 0
- * @brief A Macro that sets the size for an empty PointSet.
- */
-#define EMPTY_SET_SIZE 0
-
-/**
- * @def MINIMUM_INDEX 0
- * @brief A Macro that sets the index for the minimum value in the Set after sort operation.
- */
-#define MINIMUM_INDEX 0
-
-/**
- * @def INITIAL_CAPACITY 10
- * @brief A Macro that sets the initial capacity for the PointSet.
- */
-#define INITIAL_CAPACITY 1
-
-/**
- * @def RESIZE_FACTOR 2
- * @brief A Macro that sets the number for the capacity resize factor.
- */
-#define RESIZE_FACTOR 2
-
-/**
- * @def INVALID_INDEX -1
- * @brief A Macro that sets an invalid index in the PointSet.
- */
-#define INVALID_INDEX -1
-
-/**
- * @def EMPTY_SET_OUTPUT ""
- * @brief A Macro that sets the output for the PointSet in case the Set is empty.
- */
-#define EMPTY_SET_OUTPUT ""
-
-/**
- * @def END_OF_POINT_OUTPUT "\n"
- * @brief A Macro that sets the output for the end of a single Point output representation.
- */
-#define END_OF_POINT_OUTPUT "\n"
-
-
-/*-----=  Global Variables  =-----*/
-
-
-/**
- * @brief A pointer for the Point which will be the Axis Point during the Polar Angle Sort.
- */
-static PointP gAxisPoint;
-
-
-/*-----=  PointSet Constructors & Destructors  =-----*/
-
-
-/**
- * @brief A Default Constructor for the PointSet, which create a new PointSet ready to store Points.
- */
-PointSet::PointSet()
-{
-    _size = EMPTY_SET_SIZE;
-    _capacity = INITIAL_CAPACITY;
-    _pointSet = new PointP[_capacity];
-}
-
-/**
- * @brief A Copy Constructor for the PointSet, which create a new PointSet ready to store Points
- *        from a given PointSet data.
- * @param other The PointSet to copy.
- */
-PointSet::PointSet(const PointSet& other)
-{
-    _size = EMPTY_SET_SIZE;  // Note that '_size' will be updated by the 'add()' method.
-    this -> _capacity = other._capacity;
-    this -> _pointSet = new PointP[_capacity];
-
-    // Deep-Copy each element in the given PointSet.
-    for (int i = 0; i < other.size(); i++)
-    {
-        this -> add(*(other._pointSet[i]));
-    }
-    _initializeSet(_size, _capacity);
-}
-
-/**
- * @brief A Destructor for the PointSet.
- */
-PointSet::~PointSet()
-{
-    for (int i = 0; i < _size; i++)
-    {
-        delete _pointSet[i];
-    }
-    delete[] _pointSet;
-}
-
-
-/*-----=  PointSet Misc. Methods  =-----*/
-
-
-/**
- * @brief Initialize the PointSet container with NULL Pointers in the given range.
- * @param startIndex The index to start initialize the PointP cells. (inclusive).
- * @param endIndex The index to end initialize the PointP cells. (exclusive).
- */
-void PointSet::_initializeSet(int const startIndex, int const endIndex)
-{
-    assert(startIndex >= EMPTY_SET_SIZE && endIndex <= _capacity);
-    for (int i = startIndex; i < endIndex; i++)
-    {
-        _pointSet[i] = nullptr;
-    }
-}
-
-/**
- * @brief Finds the given Point in the PointSet if exists and return it's index in the Set.
- *        If the given Point does not exist, returns INVALID_INDEX.
- * @param point The Point to find.
- * @return The index of the Point in the Set if exists, otherwise return INVALID_INDEX.
- */
-int PointSet::_findPoint(const Point& point) const
-{
-    for (int i = 0; i < _size; i++)
-    {
-        if (*(_pointSet[i]) == point)
-        {
-            return i;
-        }
-    }
-    return INVALID_INDEX;
-}
-
-/**
- * @brief Represent the PointSet as a string for output use.
- * @return A string representation of the PointSet.
- */
-std::string PointSet::toString() const
-{
-    std::string result = EMPTY_SET_OUTPUT;
-    for (int i = 0; i < _size; i++)
-    {
-        result += (_pointSet[i]) -> toString() + END_OF_POINT_OUTPUT;
-    }
-    return result;
-}
-
-/**
- * @brief Swap data between the 2 given PointSets.
- * @param pointSet1 The first PointSet to swap.
- * @param pointSet2 The second PointSet to swap.
- */
-void PointSet::_swapData(PointSet& pointSet1, PointSet& pointSet2)
-{
-    PointP *tempSet = pointSet1._pointSet;
-    pointSet1._pointSet = pointSet2._pointSet;
-    pointSet2._pointSet = tempSet;
-
-    int tempSize = pointSet1._size;
-    pointSet1._size = pointSet2._size;
-    pointSet2._size = tempSize;
-
-    int tempCapacity = pointSet1._capacity;
-    pointSet1._capacity = pointSet2._capacity;
-    pointSet2._capacity = tempCapacity;
-}
-
-
-/*-----=  PointSet Addition  =-----*/
-
-
-/**
- * @brief Adds a given Point to the PointSet.
- *        The new Point will be inserted to the end of the PointSet.
- *        If the Point is already in the Set, this method will do nothing.
- * @param point The new Point to insert.
- * @return true if the insertion succeed, false otherwise.
- */
-bool PointSet::add(const Point& point)
-{
-    // Check if the new Point to add is already exists in the PointSet.
-    if (_findPoint(point) != INVALID_INDEX)
-    {
-        return false;
-    }
-
-    // Validate the capacity of the PointSet for inserting a new Point.
-    if (_size == (_capacity - 1))
-    {
-        _resizePointSet();
-    }
-
-    // Allocate place for the new Point.
-    _pointSet[_size] = new Point;
-
-    // Update the PointSet.
-    *(_pointSet[_size]) = point;
-    _size++;
-
-    return true;
-}
-
-/**
- * @brief Resize the PointSet capacity.
- *        The Resize operation allocates memory for the new capacity, and copies all the data
- *        from the current Set to the new larger Set.
- */
-void PointSet::_resizePointSet()
-{
-    // Allocate the new PointSet.
-    PointP *newPointSet = nullptr;
-    newPointSet = new PointP[_capacity * RESIZE_FACTOR];
-
-    PointP *oldPointSet = _pointSet;
-
-    // Copy the data from the current Set to the new Set.
-    for (int i = 0; i < _size; i++)
-    {
-        newPointSet[i] = oldPointSet[i];
-    }
-
-    delete[] oldPointSet;
-
-    // Update the PointSet data.
-    _pointSet = newPointSet;
-    _capacity *= RESIZE_FACTOR;
-    _initializeSet(_size, _capacity);  // Initialize all the new cells.
-}
-
-
-/*-----=  PointSet Deletion  =-----*/
-
-
-/**
- * @brief Trims a gap in the PointSet which can occur during the removal operation.
- *        This method sets each PointP cell in the Set to point to the following cell, starting
- *        from the given index.
- * @param gapIndex The index to start the trimming process from.
- */
-void PointSet::_trimGap(int const gapIndex)
-{
-    assert(gapIndex >= EMPTY_SET_SIZE && gapIndex < _size);
-    for (int i = gapIndex; i < (_size - 1); i++)
-    {
-        _pointSet[i] = _pointSet[i + 1];
-    }
-    _pointSet[_size - 1] = nullptr;
-}
-
-/**
- * @brief Removes a given Point from the PointSet if exists, and updates the PointSet accordingly.
- *        If the Point does not exist in the Set, this method will do nothing.
- * @param point The Point to remove.
- * @return true if the removal succeed, false otherwise.
- */
-bool PointSet::remove(const Point& point)
-{
-    // Find the desired Point in the PointSet.
-    int pointIndex = _findPoint(point);
-    if (pointIndex != INVALID_INDEX)
-    {
-        PointP toDelete = _pointSet[pointIndex];
-
-        // Trim the gap in the PointSet where the Point to remove appears.
-        _trimGap(pointIndex);
-
-        // Update the PointSet.
-        delete toDelete;
-        _size--;
-
-        return true;
-    }
-    return false;
-}
-
-
-/*-----=  PointSet Sorting  =-----*/
-
-
-/**
- * @brief A comparator function used for sorting Points in the PointSet.
- *        This comparator compares 2 Points by their Y coordinate value.
- *        If the 2 Points comparison turn to be equal, we will compare by their X coordinate value.
- * @param point1 A pointer to the first Point to compare.
- * @param point2 A pointer to the second Point to compare.
- * @return true if the first Point is smaller then the second Point.
- */
-static bool yComparator(const PointP point1, const PointP point2)
-{
-    return ((point1 -> getY()) < (point2 -> getY())) ||
-            ((point1 -> getY()) == (point2 -> getY()) && (point1 -> getX()) < (point2 -> getX()));
-}
-
-/**
- * @brief A comparator function used for sorting Points in the PointSet.
- *        This comparator compares 2 Points by their X coordinate value.
- *        If the 2 Points comparison turn to be equal, we will compare by their Y coordinate value.
- * @param point1 A pointer to the first Point to compare.
- * @param point2 A pointer to the second Point to compare.
- * @return true if the first Point is smaller then the second Point.
- */
-static bool xComparator(const PointP point1, const PointP point2)
-{
-    return ((point1 -> getX()) < (point2 -> getX())) ||
-            ((point1 -> getX()) == (point2 -> getX()) && (point1 -> getY()) < (point2 -> getY()));
-}
-
-/**
- * @brief A comparator function used for sorting Points in the PointSet.
- *        This comparator compares 2 Points by their polar angle from the Axis Point value.
- *        If the 2 Points comparison turn to be equal, we will compare by their distance.
- * @param point1 A pointer to the first Point to compare.
- * @param point2 A pointer to the second Point to compare.
- * @return true if the first Point is smaller then the second Point.
- */
-static bool polarComparator(const PointP point1, const PointP point2)
-{
-    if ((point1 -> polarAngle(*gAxisPoint)) == (point2 -> polarAngle(*gAxisPoint)))
-    {
-        // If the Polar Angle is equal, we compare by the distance from the Axis Point.
-        return point1 -> distance(*gAxisPoint) < point2 -> distance(*gAxisPoint);
-    }
-    return (point1 -> polarAngle(*gAxisPoint)) < (point2 -> polarAngle(*gAxisPoint));
-}
-
-/**
- * @brief Sort the PointSet according to the X coordinates.
- */
-void PointSet::sortSet()
-{
-    if (_size != EMPTY_SET_SIZE)
-    {
-        std::sort(_pointSet, _pointSet + _size, xComparator);
-    }
-}
-
-/**
- * @brief Sort the PointSet according to the Polar Angles.
- */
-void PointSet::sortByPolar()
-{
-    if (_size != EMPTY_SET_SIZE)
-    {
-        // First we get the minimum Y value.
-        std::stable_sort(_pointSet, _pointSet + _size, yComparator);
-        gAxisPoint = _pointSet[MINIMUM_INDEX];
-
-        // The n we sort all the rest of the Points according to our minimum.
-        std::stable_sort(_pointSet + 1, _pointSet + _size, polarComparator);
-    }
-}
-
-
-/*-----=  PointSet Operators Overload  =-----*/
-
-
-/**
- * @brief An operator overload for the operator '[]' which gets the element in the
- *        given index in the PointSet.
- * @param index The required index in the PointSet.
- * @return The element in the given index.
- */
-const Point& PointSet::operator[](int const index) const
-{
-    assert(index >= EMPTY_SET_SIZE && index < _size);
-    return *(this -> _pointSet[index]);
-}
-
-/**
- * @brief An operator overload for the comparison operator '==' which compares
- *        this PointSet with another given PointSet.
- * @param other A reference for the PointSet to compare to.
- * @return true if both Sets contains the same elements, false otherwise.
- */
-bool PointSet::operator==(const PointSet& other) const
-{
-    if (this -> _size != other._size)
-    {
-        return false;
-    }
-
-    // If both Sets have the same number of Elements, we will iterate on the current Set and check
-    // that for each Point, the other Set contains that Point too.
-    PointP currentPoint = nullptr;
-    for (int i = 0; i < _size; i++)
-    {
-        currentPoint = _pointSet[i];
-        if (other._findPoint(*currentPoint) == INVALID_INDEX)
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-/**
- * @brief An operator overload for the comparison operator '!=' which compares
- *        this PointSet with another given PointSet.
- * @param other A reference for the PointSet to compare to.
- * @return true if the Sets does not contain the same elements, false otherwise.
- */
-bool PointSet::operator!=(const PointSet& other) const
-{
-    return !(*this == other);
-}
-
-/**
- * @brief An operator overload for the subtract operator '-' which subtracts all the Points
- *        that appears in the given PointSet from this PointSet.
- * @param other A reference for the PointSet to subtract with.
- * @return PointSet which include only the Points that appears in this PointSet
- *         and not in the other PointSet.
- */
-PointSet PointSet::operator-(const PointSet& other) const
-{
-    PointSet resultSet;
-
-    PointP currentPoint = nullptr;
-    for (int i = 0; i < _size; i++)
-    {
-        currentPoint = _pointSet[i];
-        if (other._findPoint(*currentPoint) == INVALID_INDEX)
-        {
-            resultSet.add(*currentPoint);
-        }
-    }
-
-    return resultSet;
-}
-
-/**
- * @brief An operator overload for the intersect operator '&' which intersect the Points from this
- *        PointSet and the given PointSet.
- * @param other A reference for the PointSet to intersect with.
- * @return PointSet which include only the Points that appears both in this PointSet
- *         and in the other PointSet.
- */
-PointSet PointSet::operator&(const PointSet& other) const
-{
-    PointSet resultSet;
-
-    PointP currentPoint = nullptr;
-    for (int i = 0; i < _size; i++)
-    {
-        currentPoint = _pointSet[i];
-        if (other._findPoint(*currentPoint) != INVALID_INDEX)
-        {
-            resultSet.add(*currentPoint);
-        }
-    }
-
-    return resultSet;
-}
-
-/**
- * @brief An operator overload for the assignment operator '=' which assign the given PointSet
- *        to this PointSet.
- * @param other A reference for the PointSet to assign it's data.
- * @return The assigned PointSet with the required data.
- */
-PointSet& PointSet::operator=(const PointSet& other)
-{
-    if (*this != other)
-    {
-        PointSet newSet(other);
-        _swapData(*this, newSet);
-    }
-    return *this;
-}
-
+/**
+ * @file PointSet.cpp
+ * @author Itai Tagar <itagar>
+ * @version 2.5
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the PointSet Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the PointSet Class implementation.
+ * Define the PointSet Class methods and fields.
+ * A PointSet class is a Set which holds Points and allows several operations associated with a Set.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+#include "PointSetInstrumentation.h"
+#include "PointSetView.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def EMPTY_SET_SIZE 0
+ * @brief A Macro that sets the size for an empty PointSet.
+ */
+#define EMPTY_SET_SIZE 0
+
+/**
+ * @def EMPTY_FINGERPRINT 0
+ * @brief A Macro that sets the fingerprint of an empty PointSet.
+ */
+#define EMPTY_FINGERPRINT 0
+
+/**
+ * @def SINGLE_OWNER 1
+ * @brief A Macro that sets the number of references of storage which is owned by a single Set.
+ */
+#define SINGLE_OWNER 1
+
+/**
+ * @def RESIZE_FACTOR 2
+ * @brief A Macro that sets the number for the capacity resize factor.
+ */
+#define RESIZE_FACTOR 2
+
+/**
+ * @def CHAIN_CAPACITY_FACTOR 2
+ * @brief A Macro that sets the room for the Monotone Chain output, relative to its input.
+ */
+#define CHAIN_CAPACITY_FACTOR 2
+
+/**
+ * @def MORTON_BLOCK_SIZE 64
+ * @brief A Macro that sets the number of Points in a block of a Set in Morton order, which is
+ *        checked against a polygon by its bounding box.
+ */
+#define MORTON_BLOCK_SIZE 64
+
+/**
+ * @def BOX_CORNERS 4
+ * @brief A Macro that sets the number of corners of a bounding box.
+ */
+#define BOX_CORNERS 4
+
+/**
+ * @def TRIANGLE_CORNERS 3
+ * @brief A Macro that sets the number of corners of a triangle, the smallest Hull with an area.
+ */
+#define TRIANGLE_CORNERS 3
+
+/**
+ * @def INVALID_INDEX -1
+ * @brief A Macro that sets an invalid index in the PointSet.
+ */
+#define INVALID_INDEX -1
+
+/**
+ * @def EMPTY_SET_OUTPUT ""
+ * @brief A Macro that sets the output for the PointSet in case the Set is empty.
+ */
+#define EMPTY_SET_OUTPUT ""
+
+/**
+ * @def END_OF_POINT_OUTPUT "\n"
+ * @brief A Macro that sets the output for the end of a single Point output representation.
+ */
+#define END_OF_POINT_OUTPUT "\n"
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The position of a block of Points with respect to a convex polygon.
+ */
+enum BlockPosition
+{
+    BLOCK_INSIDE,
+    BLOCK_OUTSIDE,
+    BLOCK_CROSSING
+};
+
+/**
+ * @brief A Point and its Morton key.
+ */
+struct MortonPoint
+{
+    uint64_t key;  // The Morton key of the Point.
+    Point point;  // The Point.
+};
+
+
+/*-----=  Global Variables  =-----*/
+
+
+/**
+ * @brief The Point which will be the Axis Point during the Polar Angle Sort.
+ *        Each thread has its own Axis Point, so several threads may sort at the same time.
+ */
+static thread_local Point gAxisPoint;
+
+
+/*-----=  Convex Hull Helpers  =-----*/
+
+
+/**
+ * @brief Checks if a given Point is outside a convex polygon, so adding it changes the polygon.
+ *        A Point on the line of an edge is outside unless it is between the ends of the edge.
+ * @param hull The corners of the polygon in Counter-Clockwise order, without collinear corners.
+ * @param point The Point to check, which is not a corner.
+ * @return true if the Point is outside the polygon, false if it is inside or on its boundary.
+ */
+static bool outsideHull(const std::vector<Point>& hull, const Point& point)
+{
+    int corners = (int) hull.size();
+    if (corners == EMPTY_SET_SIZE)
+    {
+        return true;
+    }
+    for (int corner = 0; corner < corners; corner++)
+    {
+        const Point& start = hull[corner];
+        const Point& end = hull[(corner + 1) % corners];
+        int turn = start.orientation(end, point);
+        if ((turn < 0) || ((turn == 0) && !(start.lessByX(point) == point.lessByX(end))))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Checks if a given Point is strictly inside a convex polygon.
+ * @param polygon The corners of the polygon in Counter-Clockwise order.
+ * @param corners The number of corners of the polygon.
+ * @param point The Point to check.
+ * @return true if the Point is strictly inside the polygon.
+ */
+static bool insidePolygon(const Point polygon[], int const corners, const Point& point)
+{
+    for (int corner = 0; corner < corners; corner++)
+    {
+        if (polygon[corner].orientation(polygon[(corner + 1) % corners], point) <= 0)
+        {
+            return false;
+        }
+    }
+    return corners > EMPTY_SET_SIZE;
+}
+
+
+/*-----=  PointSet Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Default Constructor for the PointSet, which create a new PointSet ready to store Points.
+ */
+PointSet::PointSet()
+{
+    _size = EMPTY_SET_SIZE;
+    _fingerprint = EMPTY_FINGERPRINT;
+    _mortonOrdered = true;
+    _hull = nullptr;
+    _allocateStorage(POINTSET_INLINE_CAPACITY);
+}
+
+/**
+ * @brief A Copy Constructor for the PointSet, which create a new PointSet ready to store Points
+ *        from a given PointSet data.
+ *        The copy shares the heap storage of the given PointSet in O(1), and the storage is
+ *        cloned only when one of the Sets is modified (Copy-On-Write). The Points of an inline
+ *        PointSet are copied, as there are only a few of them.
+ * @param other The PointSet to copy.
+ */
+PointSet::PointSet(const PointSet& other)
+{
+    this -> _size = other._size;
+    this -> _fingerprint = other._fingerprint;
+    this -> _mortonOrdered = other._mortonOrdered;
+    std::vector<Point> *hull = other._hull.load(std::memory_order_acquire);
+    this -> _hull = (hull != nullptr) ? new std::vector<Point>(*hull) : nullptr;
+    std::copy(other._extremes, other._extremes + EXTREME_POINT_KINDS, this -> _extremes);
+    if (other._isInline())
+    {
+        _allocateStorage(POINTSET_INLINE_CAPACITY);
+        std::copy(other._pointSet, other._pointSet + other._size, this -> _pointSet);
+        return;
+    }
+    this -> _capacity = other._capacity;
+    this -> _pointSet = other._pointSet;
+    this -> _references = other._references;
+    _references -> fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief A Constructor for the PointSet, which create a new PointSet from a given array of
+ *        distinct Points in O(n). The Points are not checked for repetitions, so this is the
+ *        way to hand over Points which are already known to be unique.
+ * @param points The array of distinct Points.
+ * @param count The number of Points in the array.
+ */
+PointSet::PointSet(const Point points[], int const count)
+{
+    _size = count;
+    _fingerprint = EMPTY_FINGERPRINT;
+    _mortonOrdered = (count <= 1);
+    _hull = nullptr;
+    int capacity = POINTSET_INLINE_CAPACITY;
+    while (capacity < count)
+    {
+        capacity *= RESIZE_FACTOR;
+    }
+    _allocateStorage(capacity);
+
+    for (int i = 0; i < count; i++)
+    {
+        _pointSet[i] = points[i];
+        _fingerprint += points[i].hash();
+    }
+    _findExtremes();
+}
+
+/**
+ * @brief A Destructor for the PointSet.
+ */
+PointSet::~PointSet()
+{
+    _releaseStorage();
+    delete _hull.load(std::memory_order_relaxed);
+}
+
+
+/*-----=  PointSet Misc. Methods  =-----*/
+
+
+/**
+ * @brief Sets this PointSet to hold its Points inline, or in new heap storage if the given
+ *        capacity is larger than the inline capacity. The Points are not copied.
+ * @param capacity The required capacity.
+ */
+void PointSet::_allocateStorage(int const capacity)
+{
+    if (capacity <= POINTSET_INLINE_CAPACITY)
+    {
+        _capacity = POINTSET_INLINE_CAPACITY;
+        _pointSet = _inlinePoints;
+        _references = nullptr;
+        return;
+    }
+    _capacity = capacity;
+    _pointSet = new Point[_capacity];
+    _references = new std::atomic<int>(SINGLE_OWNER);
+}
+
+/**
+ * @brief Releases the reference of this PointSet to its storage, and frees the storage if no
+ *        other PointSet shares it. Inline storage is never shared.
+ */
+void PointSet::_releaseStorage()
+{
+    if (!_isInline() && (_references -> fetch_sub(1, std::memory_order_acq_rel) == SINGLE_OWNER))
+    {
+        delete[] _pointSet;
+        delete _references;
+    }
+}
+
+/**
+ * @brief Makes sure that this PointSet is the only owner of its storage before it is modified,
+ *        by cloning the storage if it is shared with other PointSets.
+ */
+void PointSet::_detach()
+{
+    if (_isInline() || (_references -> load(std::memory_order_acquire) == SINGLE_OWNER))
+    {
+        return;
+    }
+
+    Point *newPointSet = new Point[_capacity];
+    std::copy(_pointSet, _pointSet + _size, newPointSet);
+    _releaseStorage();
+
+    _pointSet = newPointSet;
+    _references = new std::atomic<int>(SINGLE_OWNER);
+}
+
+
+/**
+ * @brief Finds the given Point in the PointSet if exists and return it's index in the Set.
+ *        If the given Point does not exist, returns INVALID_INDEX.
+ *        A Set in Morton order is searched with a binary search.
+ * @param point The Point to find.
+ * @return The index of the Point in the Set if exists, otherwise return INVALID_INDEX.
+ */
+int PointSet::_findPoint(const Point& point) const
+{
+    MEASURE_LATENCY(MEASURED_FIND_POINT);
+
+    if (!mayContain(point))
+    {
+        return INVALID_INDEX;
+    }
+    int index = _mortonOrdered ? findMortonIndex(_pointSet, _size, point) :
+                findPointIndex(_pointSet, _size, point);
+    return (index == POINT_NOT_FOUND) ? INVALID_INDEX : index;
+}
+
+/**
+ * @brief Represent the PointSet as a string for output use.
+ * @return A string representation of the PointSet.
+ */
+std::string PointSet::toString() const
+{
+    std::string result = EMPTY_SET_OUTPUT;
+    for (int i = 0; i < _size; i++)
+    {
+        result += _pointSet[i].toString() + END_OF_POINT_OUTPUT;
+    }
+    return result;
+}
+
+/**
+ * @brief Swap data between the 2 given PointSets.
+ *        The inline Points are swapped as well, and an inline PointSet points to its own inline
+ *        container after the swap.
+ * @param pointSet1 The first PointSet to swap.
+ * @param pointSet2 The second PointSet to swap.
+ */
+void PointSet::_swapData(PointSet& pointSet1, PointSet& pointSet2)
+{
+    bool inline1 = pointSet1._isInline();
+    bool inline2 = pointSet2._isInline();
+    std::swap_ranges(pointSet1._inlinePoints, pointSet1._inlinePoints + POINTSET_INLINE_CAPACITY,
+                     pointSet2._inlinePoints);
+
+    Point *tempSet = inline1 ? pointSet2._inlinePoints : pointSet1._pointSet;
+    pointSet1._pointSet = inline2 ? pointSet1._inlinePoints : pointSet2._pointSet;
+    pointSet2._pointSet = tempSet;
+
+    int tempSize = pointSet1._size;
+    pointSet1._size = pointSet2._size;
+    pointSet2._size = tempSize;
+
+    int tempCapacity = pointSet1._capacity;
+    pointSet1._capacity = pointSet2._capacity;
+    pointSet2._capacity = tempCapacity;
+
+    uint64_t tempFingerprint = pointSet1._fingerprint;
+    pointSet1._fingerprint = pointSet2._fingerprint;
+    pointSet2._fingerprint = tempFingerprint;
+
+    std::atomic<int> *tempReferences = pointSet1._references;
+    pointSet1._references = pointSet2._references;
+    pointSet2._references = tempReferences;
+
+    bool tempMortonOrdered = pointSet1._mortonOrdered;
+    pointSet1._mortonOrdered = pointSet2._mortonOrdered;
+    pointSet2._mortonOrdered = tempMortonOrdered;
+
+    std::swap_ranges(pointSet1._extremes, pointSet1._extremes + EXTREME_POINT_KINDS,
+                     pointSet2._extremes);
+
+    std::vector<Point> *tempHull = pointSet1._hull.load(std::memory_order_relaxed);
+    pointSet1._hull = pointSet2._hull.load(std::memory_order_relaxed);
+    pointSet2._hull = tempHull;
+}
+
+/**
+ * @brief Replaces the cached Convex Hull.
+ * @param hull The new cached Hull, or null to drop the cache.
+ */
+void PointSet::_setHull(std::vector<Point> *hull)
+{
+    delete _hull.exchange(hull, std::memory_order_acq_rel);
+}
+
+
+/*-----=  PointSet Addition  =-----*/
+
+
+/**
+ * @brief Adds a given Point to the PointSet.
+ *        The new Point will be inserted to the end of the PointSet.
+ *        If the Point is already in the Set, this method will do nothing.
+ * @param point The new Point to insert.
+ * @return true if the insertion succeed, false otherwise.
+ */
+bool PointSet::add(const Point& point)
+{
+    MEASURE_LATENCY(MEASURED_ADD);
+
+    // Check if the new Point to add is already exists in the PointSet.
+    if (_findPoint(point) != INVALID_INDEX)
+    {
+        return false;
+    }
+
+    // Validate the capacity of the PointSet for inserting a new Point.
+    if (_size == _capacity)
+    {
+        _resizePointSet();
+    }
+    else
+    {
+        _detach();
+    }
+
+    // Update the PointSet. The Morton order is kept if the new Point comes after the last one.
+    _mortonOrdered = _mortonOrdered &&
+                     ((_size == EMPTY_SET_SIZE) || _pointSet[_size - 1].lessByMorton(point));
+    _extendExtremes(point);
+    _pointSet[_size] = point;
+    _size++;
+    _fingerprint += point.hash();
+
+    // The cached Hull changes only if the new Point is outside of it.
+    std::vector<Point> *hull = _hull.load(std::memory_order_relaxed);
+    if ((hull != nullptr) && outsideHull(*hull, point))
+    {
+        _insertIntoHull(*hull, point);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Resize the PointSet capacity.
+ *        The Resize operation allocates memory for the new capacity, and copies all the data
+ *        from the current Set to the new larger Set.
+ */
+void PointSet::_resizePointSet()
+{
+    MEASURE_LATENCY(MEASURED_RESIZE);
+
+    // Allocate the new PointSet.
+    Point *newPointSet = nullptr;
+    newPointSet = new Point[_capacity * RESIZE_FACTOR];
+
+    const Point *oldPointSet = _pointSet;
+
+    // Copy the data from the current Set to the new Set.
+    for (int i = 0; i < _size; i++)
+    {
+        newPointSet[i] = oldPointSet[i];
+    }
+
+    // The old storage is freed unless it is inline or still shared with other PointSets.
+    _releaseStorage();
+
+    // Update the PointSet data.
+    _pointSet = newPointSet;
+    _references = new std::atomic<int>(SINGLE_OWNER);
+    _capacity *= RESIZE_FACTOR;
+}
+
+
+/*-----=  PointSet Deletion  =-----*/
+
+
+/**
+ * @brief Trims a gap in the PointSet which can occur during the removal operation.
+ *        This method moves each Point in the Set to the previous cell, starting from the given
+ *        index.
+ * @param gapIndex The index to start the trimming process from.
+ */
+void PointSet::_trimGap(int const gapIndex)
+{
+    assert(gapIndex >= EMPTY_SET_SIZE && gapIndex < _size);
+    for (int i = gapIndex; i < (_size - 1); i++)
+    {
+        _pointSet[i] = _pointSet[i + 1];
+    }
+}
+
+/**
+ * @brief Removes a given Point from the PointSet if exists, and updates the PointSet accordingly.
+ *        If the Point does not exist in the Set, this method will do nothing.
+ * @param point The Point to remove.
+ * @return true if the removal succeed, false otherwise.
+ */
+bool PointSet::remove(const Point& point)
+{
+    MEASURE_LATENCY(MEASURED_REMOVE);
+
+    // Find the desired Point in the PointSet.
+    int pointIndex = _findPoint(point);
+    if (pointIndex != INVALID_INDEX)
+    {
+        _detach();
+
+        // Trim the gap in the PointSet where the Point to remove appears. The given Point may be
+        // an element of the Set, which the trimming overwrites, so a copy of it is kept.
+        Point removed = _pointSet[pointIndex];
+        _trimGap(pointIndex);
+
+        // Update the PointSet. The cached Hull is dropped only if the Point was on it.
+        _size--;
+        _fingerprint -= removed.hash();
+        if (std::find(_extremes, _extremes + EXTREME_POINT_KINDS, removed) !=
+            _extremes + EXTREME_POINT_KINDS)
+        {
+            _findExtremes();
+        }
+        std::vector<Point> *hull = _hull.load(std::memory_order_relaxed);
+        if ((hull != nullptr) &&
+            (std::find(hull -> begin(), hull -> end(), removed) != hull -> end()))
+        {
+            _setHull(nullptr);
+        }
+
+        return true;
+    }
+    return false;
+}
+
+
+/*-----=  PointSet Sorting  =-----*/
+
+
+/**
+ * @brief A comparator function used for sorting Points in the PointSet.
+ *        This comparator compares 2 Points by their X coordinate value.
+ *        If the 2 Points comparison turn to be equal, we will compare by their Y coordinate value.
+ * @param point1 The first Point to compare.
+ * @param point2 The second Point to compare.
+ * @return true if the first Point is smaller then the second Point.
+ */
+static bool xComparator(const Point& point1, const Point& point2)
+{
+    return point1.lessByX(point2);
+}
+
+/**
+ * @brief A comparator function used for sorting Points in the PointSet.
+ *        This comparator compares 2 Points by their polar angle from the Axis Point value.
+ *        If the 2 Points comparison turn to be equal, we will compare by their distance.
+ *        All the Points are above the Axis Point (or to its right), so their angles are in
+ *        [0, Pi) and the angles are compared exactly by the orientation of the turn between them.
+ * @param point1 The first Point to compare.
+ * @param point2 The second Point to compare.
+ * @return true if the first Point is smaller then the second Point.
+ */
+static bool polarComparator(const Point& point1, const Point& point2)
+{
+    int orientation = gAxisPoint.orientation(point1, point2);
+    if (orientation == 0)
+    {
+        // If the Polar Angle is equal, we compare by the distance from the Axis Point.
+        return point1.squaredDistance(gAxisPoint) < point2.squaredDistance(gAxisPoint);
+    }
+    return orientation > 0;
+}
+
+/**
+ * @brief Sort the PointSet according to the X coordinates.
+ */
+void PointSet::sortSet()
+{
+    if (_size != EMPTY_SET_SIZE)
+    {
+        _detach();
+        std::sort(_pointSet, _pointSet + _size, xComparator);
+        _mortonOrdered = false;
+    }
+}
+
+/**
+ * @brief Sort the PointSet according to the Polar Angles.
+ */
+void PointSet::sortByPolar()
+{
+    if (_size != EMPTY_SET_SIZE)
+    {
+        _detach();
+
+        // The lowest Point is the Axis Point, and it is sorted first as its distance is 0.
+        gAxisPoint = _extremes[LOWEST_POINT];
+
+        // Then we sort all the Points according to our minimum.
+        // The Points are distinct, so the order is total and the sort does not need to be stable.
+        std::sort(_pointSet, _pointSet + _size, polarComparator);
+        _mortonOrdered = false;
+    }
+}
+
+/**
+ * @brief Sort the PointSet according to the Morton keys of the Points (the Z-order curve).
+ *        The key of every Point is calculated once, and the Points are sorted with their keys.
+ */
+void PointSet::sortByMorton()
+{
+    if (_size != EMPTY_SET_SIZE)
+    {
+        _detach();
+        std::vector<MortonPoint> keyed(_size);
+        for (int i = 0; i < _size; i++)
+        {
+            keyed[i] = {_pointSet[i].mortonKey(), _pointSet[i]};
+        }
+        std::sort(keyed.begin(), keyed.end(), [](const MortonPoint& point1,
+                                                 const MortonPoint& point2)
+                  {
+                      return (point1.key != point2.key) ? (point1.key < point2.key) :
+                             point1.point.lessByX(point2.point);
+                  });
+        for (int i = 0; i < _size; i++)
+        {
+            _pointSet[i] = keyed[i].point;
+        }
+    }
+    _mortonOrdered = true;
+}
+
+
+/*-----=  PointSet Bulk Scans  =-----*/
+
+
+/**
+ * @brief Returns the extreme Point of the given kind in the PointSet, which must not be empty,
+ *        in O(1).
+ * @param kind The kind of the extreme Point.
+ * @return The extreme Point.
+ */
+const Point& PointSet::extremePoint(ExtremePoint const kind) const
+{
+    assert(_size > EMPTY_SET_SIZE);
+    return _extremes[kind];
+}
+
+/**
+ * @brief Checks in O(1) if a given Point is inside the bounding box of the PointSet, i.e. it
+ *        may be in the Set.
+ * @param point The Point to check.
+ * @return true if the Point is inside the bounding box, false if it is surely not in the Set.
+ */
+bool PointSet::mayContain(const Point& point) const
+{
+    return (_size != EMPTY_SET_SIZE) &&
+           !(point.getX() < _extremes[LEFTMOST_POINT].getX()) &&
+           !(_extremes[RIGHTMOST_POINT].getX() < point.getX()) &&
+           !(point.getY() < _extremes[LOWEST_POINT].getY()) &&
+           !(_extremes[HIGHEST_POINT].getY() < point.getY());
+}
+
+/**
+ * @brief Updates the extreme Points with a Point which is added to the PointSet.
+ *        The first Point of the Set is all of its extreme Points.
+ * @param point The added Point.
+ */
+void PointSet::_extendExtremes(const Point& point)
+{
+    for (int kind = LOWEST_POINT; kind < EXTREME_POINT_KINDS; kind++)
+    {
+        if ((_size == EMPTY_SET_SIZE) || moreExtreme(point, _extremes[kind], (ExtremePoint) kind))
+        {
+            _extremes[kind] = point;
+        }
+    }
+}
+
+/**
+ * @brief Finds the extreme Points of the PointSet again, after one of them was removed.
+ */
+void PointSet::_findExtremes()
+{
+    if (_size == EMPTY_SET_SIZE)
+    {
+        return;
+    }
+    for (int kind = LOWEST_POINT; kind < EXTREME_POINT_KINDS; kind++)
+    {
+        _extremes[kind] = _pointSet[findExtremeIndex(_pointSet, _size, (ExtremePoint) kind)];
+    }
+}
+
+/**
+ * @brief Checks in O(1) if the bounding boxes of this PointSet and another PointSet overlap,
+ *        i.e. the Sets may have common Points.
+ * @param other The other PointSet.
+ * @return true if the bounding boxes overlap, false if the Sets surely have no common Point.
+ */
+bool PointSet::_boxesOverlap(const PointSet& other) const
+{
+    return (_size != EMPTY_SET_SIZE) && (other._size != EMPTY_SET_SIZE) &&
+           !(other._extremes[RIGHTMOST_POINT].getX() < _extremes[LEFTMOST_POINT].getX()) &&
+           !(_extremes[RIGHTMOST_POINT].getX() < other._extremes[LEFTMOST_POINT].getX()) &&
+           !(other._extremes[HIGHEST_POINT].getY() < _extremes[LOWEST_POINT].getY()) &&
+           !(_extremes[HIGHEST_POINT].getY() < other._extremes[LOWEST_POINT].getY());
+}
+
+/**
+ * @brief Finds the position of a block of Points with respect to a convex polygon by the bounding
+ *        box of the block: the box is inside if all its corners are strictly inside the polygon,
+ *        and it is outside if all its corners are strictly outside the same edge.
+ * @param points The Points of the block.
+ * @param count The number of Points in the block, which must be positive.
+ * @param polygon The corners of the polygon in Counter-Clockwise order.
+ * @param corners The number of corners of the polygon.
+ * @return The position of the block.
+ */
+static BlockPosition classifyBlock(const Point points[], int const count, const Point polygon[],
+                                   int const corners)
+{
+    Coordinate minX = points[0].getX(), maxX = minX, minY = points[0].getY(), maxY = minY;
+    for (int i = 1; i < count; i++)
+    {
+        minX = std::min(minX, points[i].getX());
+        maxX = std::max(maxX, points[i].getX());
+        minY = std::min(minY, points[i].getY());
+        maxY = std::max(maxY, points[i].getY());
+    }
+    Point box[BOX_CORNERS] = {Point(minX, minY), Point(maxX, minY), Point(maxX, maxY),
+                              Point(minX, maxY)};
+
+    bool inside = true;
+    for (int corner = 0; corner < corners; corner++)
+    {
+        int counterClockwise = 0;
+        int clockwise = 0;
+        for (const Point& boxCorner : box)
+        {
+            int orientation = polygon[corner].orientation(polygon[(corner + 1) % corners],
+                                                          boxCorner);
+            counterClockwise += (orientation > 0);
+            clockwise += (orientation < 0);
+        }
+        if (clockwise == BOX_CORNERS)
+        {
+            return BLOCK_OUTSIDE;
+        }
+        inside = inside && (counterClockwise == BOX_CORNERS);
+    }
+    return inside ? BLOCK_INSIDE : BLOCK_CROSSING;
+}
+
+/**
+ * @brief Removes all the Points which are strictly inside the given convex polygon.
+ *        The Points on the boundary of the polygon are kept, and the order of the remaining
+ *        Points does not change.
+ *        The Points of a Set in Morton order are checked in blocks of close Points, and a block
+ *        whose bounding box is inside the polygon (or outside one of its edges) is removed (or
+ *        kept) without checking its Points.
+ * @param polygon The corners of the polygon in Counter-Clockwise order.
+ * @param corners The number of corners of the polygon.
+ * @return The number of the removed Points.
+ */
+int PointSet::removeInterior(const Point polygon[], int const corners)
+{
+    std::vector<signed char> inside(_size, 1);
+    std::vector<signed char> signs(_size);
+    int blockSize = _mortonOrdered ? MORTON_BLOCK_SIZE : std::max(_size, 1);
+    for (int first = 0; first < _size; first += blockSize)
+    {
+        int count = std::min(blockSize, _size - first);
+        BlockPosition position = _mortonOrdered ?
+                                 classifyBlock(_pointSet + first, count, polygon, corners) :
+                                 BLOCK_CROSSING;
+        if (position != BLOCK_CROSSING)
+        {
+            std::fill(inside.begin() + first, inside.begin() + first + count,
+                      position == BLOCK_INSIDE);
+            continue;
+        }
+        for (int corner = 0; corner < corners; corner++)
+        {
+            orientationSigns(polygon[corner], polygon[(corner + 1) % corners], _pointSet + first,
+                             count, signs.data() + first);
+            for (int i = first; i < first + count; i++)
+            {
+                inside[i] &= (signs[i] > 0);
+            }
+        }
+    }
+
+    // Compact the remaining Points to the start of the Set.
+    _detach();
+    int kept = 0;
+    for (int i = 0; i < _size; i++)
+    {
+        if (!inside[i])
+        {
+            _pointSet[kept++] = _pointSet[i];
+        }
+        else
+        {
+            _fingerprint -= _pointSet[i].hash();
+        }
+    }
+    int removed = _size - kept;
+    _size = kept;
+    if ((removed > 0) &&
+        std::any_of(_extremes, _extremes + EXTREME_POINT_KINDS, [&](const Point& extreme)
+                    {
+                        return insidePolygon(polygon, corners, extreme);
+                    }))
+    {
+        _findExtremes();
+    }
+
+    // The cached Hull is dropped only if one of its Points was removed.
+    std::vector<Point> *hull = _hull.load(std::memory_order_relaxed);
+    if ((removed > 0) && (hull != nullptr))
+    {
+        for (const Point& vertex : *hull)
+        {
+            if (insidePolygon(polygon, corners, vertex))
+            {
+                _setHull(nullptr);
+                break;
+            }
+        }
+    }
+    return removed;
+}
+
+
+/*-----=  PointSet Convex Hull  =-----*/
+
+
+/**
+ * @brief Returns the Convex Hull of the PointSet, without reordering it.
+ *        The Hull is calculated on the first call with the Monotone Chain on a sorted copy of the
+ *        Points, and cached. Concurrent first calls may each calculate it, and only the first
+ *        Hull to be stored is kept.
+ * @return A PointSet which contains the Convex Hull Points, in Counter-Clockwise order starting
+ *         from the lowest Point.
+ */
+PointSet PointSet::convexHull() const
+{
+    std::vector<Point> *hull = _hull.load(std::memory_order_acquire);
+    if (hull == nullptr)
+    {
+        std::vector<Point> *calculated = new std::vector<Point>(_pointSet, _pointSet + _size);
+        _reduceToHull(*calculated);
+        if (_hull.compare_exchange_strong(hull, calculated, std::memory_order_acq_rel))
+        {
+            hull = calculated;
+        }
+        else
+        {
+            delete calculated;
+        }
+    }
+    return PointSet(hull -> data(), (int) hull -> size());
+}
+
+/**
+ * @brief Replaces the given Points, which may repeat, with their Convex Hull in
+ *        Counter-Clockwise order starting from the lowest Point, in O(n*log(n)).
+ * @param points The Points.
+ */
+void PointSet::_reduceToHull(std::vector<Point>& points)
+{
+    std::sort(points.begin(), points.end(), xComparator);
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    std::vector<Point> hull(CHAIN_CAPACITY_FACTOR * points.size());
+    hull.resize(monotoneChain(points.data(), (int) points.size(), hull.data()));
+
+    // Start the Hull from the lowest Point, as the Graham Scan does.
+    std::vector<Point>::iterator lowest =
+            std::min_element(hull.begin(), hull.end(), [](const Point& point1, const Point& point2)
+                             {
+                                 return point1.lessByY(point2);
+                             });
+    std::rotate(hull.begin(), lowest, hull.end());
+    points.swap(hull);
+}
+
+/**
+ * @brief Inserts a Point which is outside a Convex Hull into the Hull in O(h).
+ *        The edges which the Point sees (the Point is to their right, or on their line) are a
+ *        single chain of the Hull, and the corners inside this chain are replaced with the Point.
+ * @param hull The Hull in Counter-Clockwise order starting from the lowest Point, without
+ *        collinear corners.
+ * @param point The Point to insert, which is outside the Hull.
+ */
+void PointSet::_insertIntoHull(std::vector<Point>& hull, const Point& point)
+{
+    int corners = (int) hull.size();
+    if (corners < TRIANGLE_CORNERS)
+    {
+        hull.push_back(point);
+        _reduceToHull(hull);
+        return;
+    }
+    auto seen = [&](int const edge)
+    {
+        return hull[edge].orientation(hull[(edge + 1) % corners], point) <= 0;
+    };
+
+    // Find the first and the last seen edges, starting the search from an edge that is not seen.
+    int hidden = 0;
+    while (seen(hidden))
+    {
+        hidden++;
+    }
+    int first = (hidden + 1) % corners;
+    while (!seen(first))
+    {
+        first = (first + 1) % corners;
+    }
+    int last = first;
+    while (seen((last + 1) % corners))
+    {
+        last = (last + 1) % corners;
+    }
+
+    // The Point connects the start of the first seen edge to the end of the last one.
+    std::vector<Point> inserted;
+    inserted.reserve(corners + 1);
+    inserted.push_back(point);
+    for (int corner = (last + 1) % corners; corner != first; corner = (corner + 1) % corners)
+    {
+        inserted.push_back(hull[corner]);
+    }
+    inserted.push_back(hull[first]);
+
+    // Start the Hull from the lowest Point again.
+    std::vector<Point>::iterator lowest =
+            std::min_element(inserted.begin(), inserted.end(),
+                             [](const Point& point1, const Point& point2)
+                             {
+                                 return point1.lessByY(point2);
+                             });
+    std::rotate(inserted.begin(), lowest, inserted.end());
+    hull.swap(inserted);
+}
+
+
+/*-----=  PointSet Operators Overload  =-----*/
+
+
+/**
+ * @brief An operator overload for the operator '[]' which gets the element in the
+ *        given index in the PointSet.
+ * @param index The required index in the PointSet.
+ * @return The element in the given index.
+ */
+const Point& PointSet::operator[](int const index) const
+{
+    assert(index >= EMPTY_SET_SIZE && index < _size);
+    return this -> _pointSet[index];
+}
+
+/**
+ * @brief An operator overload for the comparison operator '==' which compares
+ *        this PointSet with another given PointSet.
+ * @param other A reference for the PointSet to compare to.
+ * @return true if both Sets contains the same elements, false otherwise.
+ */
+bool PointSet::operator==(const PointSet& other) const
+{
+    MEASURE_LATENCY(MEASURED_EQUALITY);
+
+    if (this == &other)
+    {
+        return true;
+    }
+
+    // Sets with different sizes or fingerprints are different, so only Sets which are equal (or
+    // whose fingerprints collide) reach the full comparison.
+    if ((this -> _size != other._size) || (this -> _fingerprint != other._fingerprint))
+    {
+        return false;
+    }
+
+    // Equal Sets have the same extreme Points.
+    if ((_size != EMPTY_SET_SIZE) &&
+        !std::equal(_extremes, _extremes + EXTREME_POINT_KINDS, other._extremes))
+    {
+        return false;
+    }
+
+    // If both Sets have the same number of Elements, we will iterate on the current Set and check
+    // that for each Point, the other Set contains that Point too.
+    PointP currentPoint = nullptr;
+    for (int i = 0; i < _size; i++)
+    {
+        currentPoint = &_pointSet[i];
+        if (other._findPoint(*currentPoint) == INVALID_INDEX)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief An operator overload for the comparison operator '!=' which compares
+ *        this PointSet with another given PointSet.
+ * @param other A reference for the PointSet to compare to.
+ * @return true if the Sets does not contain the same elements, false otherwise.
+ */
+bool PointSet::operator!=(const PointSet& other) const
+{
+    return !(*this == other);
+}
+
+/**
+ * @brief An operator overload for the subtract operator '-' which subtracts all the Points
+ *        that appears in the given PointSet from this PointSet.
+ * @param other A reference for the PointSet to subtract with.
+ * @return PointSet which include only the Points that appears in this PointSet
+ *         and not in the other PointSet.
+ */
+PointSet PointSet::operator-(const PointSet& other) const
+{
+    MEASURE_LATENCY(MEASURED_DIFFERENCE);
+
+    // Sets whose bounding boxes are apart have no common Points.
+    if (!_boxesOverlap(other))
+    {
+        return *this;
+    }
+    return PointSetView(*this) - PointSetView(other);
+}
+
+/**
+ * @brief An operator overload for the subtract operator '-' which subtracts all the Points
+ *        that appears in the given view from this PointSet.
+ * @param other A reference for the view to subtract with.
+ * @return PointSet which include only the Points that appears in this PointSet
+ *         and not in the view.
+ */
+PointSet PointSet::operator-(const PointSetView& other) const
+{
+    MEASURE_LATENCY(MEASURED_DIFFERENCE);
+
+    if ((other.wholeSet() != nullptr) && !_boxesOverlap(*other.wholeSet()))
+    {
+        return *this;
+    }
+    return PointSetView(*this) - other;
+}
+
+/**
+ * @brief An operator overload for the intersect operator '&' which intersect the Points from this
+ *        PointSet and the given PointSet.
+ * @param other A reference for the PointSet to intersect with.
+ * @return PointSet which include only the Points that appears both in this PointSet
+ *         and in the other PointSet.
+ */
+PointSet PointSet::operator&(const PointSet& other) const
+{
+    MEASURE_LATENCY(MEASURED_INTERSECTION);
+
+    // Sets whose bounding boxes are apart have no common Points.
+    if (!_boxesOverlap(other))
+    {
+        return PointSet();
+    }
+    return PointSetView(*this) & PointSetView(other);
+}
+
+/**
+ * @brief An operator overload for the intersect operator '&' which intersect the Points from this
+ *        PointSet and the given view.
+ * @param other A reference for the view to intersect with.
+ * @return PointSet which include only the Points that appears both in this PointSet
+ *         and in the view.
+ */
+PointSet PointSet::operator&(const PointSetView& other) const
+{
+    MEASURE_LATENCY(MEASURED_INTERSECTION);
+
+    if ((other.wholeSet() != nullptr) && !_boxesOverlap(*other.wholeSet()))
+    {
+        return PointSet();
+    }
+    return PointSetView(*this) & other;
+}
+
+/**
+ * @brief An operator overload for the assignment operator '=' which assign the given PointSet
+ *        to this PointSet.
+ * @param other A reference for the PointSet to assign it's data.
+ * @return The assigned PointSet with the required data.
+ */
+PointSet& PointSet::operator=(const PointSet& other)
+{
+    if (*this != other)
+    {
+        PointSet newSet(other);
+        _swapData(*this, newSet);
+    }
+    return *this;
+}
+
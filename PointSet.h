@@ -1,202 +1,400 @@
-/**
- * @file PointSet.h
- * @author Itai Tagar <itagar>
- * @version 2.0
- * @date 04 Sep 2016
- *
- * @brief A Header File for the PointSet Class.
- *
- * @section LICENSE
- * This program is free to use in every operation system.
- *
- * @section DESCRIPTION
- * A Header File for the PointSet Class.
- * Declaring the PointSet Class, it's methods and fields.
- * A PointSet class is a Set which holds Points and allows several operations associated with a Set.
- */
-
-
-#ifndef EX1_POINTSET_H
-#define EX1_POINTSET_H
-
-
-/*-----=  Includes  =-----*/
-
-
-#include "Point.h"
-
-
-/*-----=  Type Definitions  =-----*/
-
-
-/**
- * @brief PointP is a pointer to a Point.
- */
-typedef Point *PointP;
-
-
-/*-----=  Class Declaration  =-----*/
-
-
-/**
- * @brief A Class representing a PointSet which contains several Points in it (without repetitions).
- *        The PointSet holds several method which perform operations of a Set.
- */
-class PointSet
-{
-public:
-
-    /**
-     * @brief A Default Constructor for the PointSet, which create a new PointSet ready to
-     *        store Points.
-     */
-    PointSet();
-
-    /**
-     * @brief A Copy Constructor for the PointSet, which create a new PointSet ready to store Points
-     *        from a given PointSet data.
-     * @param other The PointSet to copy.
-     */
-    PointSet(const PointSet& other);
-
-    /**
-     * @brief A Destructor for the PointSet.
-     */
-    ~PointSet();
-
-    /**
-     * @brief Returns the size of the PointSet, i.e. the current number of elements.
-     * @return The size of the PointSet.
-     */
-    int size() const { return _size; };
-
-    /**
-     * @brief Adds a given Point to the PointSet.
-     *        The new Point will be inserted to the end of the PointSet.
-     *        If the Point is already in the Set, this method will do nothing.
-     * @param point The new Point to insert.
-     * @return true if the insertion succeed, false otherwise.
-     */
-    bool add(const Point& point);
-
-    /**
-     * @brief Removes a given Point from the PointSet if exists, and updates the PointSet
-     *        accordingly. If the Point does not exist in the Set, this method will do nothing.
-     * @param point The Point to remove.
-     * @return true if the removal succeed, false otherwise.
-     */
-    bool remove(const Point& point);
-
-    /**
-     * @brief Represent the PointSet as a string for output use.
-     * @return A string representation of the PointSet.
-     */
-    std::string toString() const;
-
-    /**
-     * @brief Sort the PointSet according to the X coordinates.
-     */
-    void sortSet();
-
-    /**
-     * @brief Sort the PointSet according to the Polar Angles.
-     */
-    void sortByPolar();
-
-    /**
-     * @brief An operator overload for the operator '[]' which gets the element in the
-     *        given index in the PointSet.
-     * @param index The required index in the PointSet.
-     * @return The element in the given index.
-     */
-    const Point& operator[](int const index) const;
-
-    /**
-     * @brief An operator overload for the comparison operator '==' which compares
-     *        this PointSet with another given PointSet.
-     * @param other A reference for the PointSet to compare to.
-     * @return true if both Sets contains the same elements, false otherwise.
-     */
-    bool operator==(const PointSet& other) const;
-
-    /**
-     * @brief An operator overload for the comparison operator '!=' which compares
-     *        this PointSet with another given PointSet.
-     * @param other A reference for the PointSet to compare to.
-     * @return true if the Sets does not contain the same elements, false otherwise.
-     */
-    bool operator!=(const PointSet& other) const;
-
-    /**
-     * @brief An operator overload for the subtract operator '-' which subtracts all the Points
-     *        that appears in the given PointSet from this PointSet.
-     * @param other A reference for the PointSet to subtract with.
-     * @return PointSet which include only the Points that appears in this PointSet
-     *         and not in the other PointSet.
-     */
-    PointSet operator-(const PointSet& other) const;
-
-    /**
-     * @brief An operator overload for the intersect operator '&' which intersect the Points
-     *        from this PointSet and the given PointSet.
-     * @param other A reference for the PointSet to intersect with.
-     * @return PointSet which include only the Points that appears both in this PointSet
-     *         and in the other PointSet.
-     */
-    PointSet operator&(const PointSet& other) const;
-
-    /**
-     * @brief An operator overload for the assignment operator '=' which assign the given PointSet
-     *        to this PointSet.
-     * @param other A reference for the PointSet to assign it's data.
-     * @return The assigned PointSet with the required data.
-     */
-    PointSet& operator=(const PointSet& other);
-
-private:
-    // PointSet Private Fields.
-    int _size;  // The size of the PointSet, i.e. the current number of elements in the Set.
-    int _capacity;  // The capacity of the PointSet, i.e. the current maximum size to hold.
-    PointP *_pointSet;  // The container for the Points data.
-
-    /**
-     * @brief Resize the PointSet capacity.
-     *        The Resize operation allocates memory for the new capacity, and copies all the data
-     *        from the current Set to the new larger Set.
-     */
-    void _resizePointSet();
-
-    /**
-     * @brief Finds the given Point in the PointSet if exists and return it's index in the Set.
-     *        If the given Point does not exist, returns INVALID_INDEX.
-     * @param point The Point to find.
-     * @return The index of the Point in the Set if exists, otherwise return INVALID_INDEX.
-     */
-    int _findPoint(const Point& point) const;
-
-    /**
-     * @brief Initialize the PointSet container with NULL Pointers in the given range.
-     * @param startIndex The index to start initialize the PointP cells. (inclusive).
-     * @param endIndex The index to end initialize the PointP cells. (exclusive).
-     */
-    void _initializeSet(int const startIndex, int const endIndex);
-
-    /**
-     * @brief Trims a gap in the PointSet which can occur during the removal operation.
-     *        This method sets each PointP cell in the Set to point to the following cell, starting
-     *        from the given index.
-     * @param gapIndex The index to start the trimming process from.
-     */
-    void _trimGap(int const gapIndex);
-
-    /**
-     * @brief Swap data between the 2 given PointSets.
-     * @param pointSet1 The first PointSet to swap.
-     * @param pointSet2 The second PointSet to swap.
-     */
-    void _swapData(PointSet& pointSet1, PointSet& pointSet2);
-
-};
-
-
-#endif //EX1_POINTSET_H
+/**
+ * @file PointSet.h
+ * @author Itai Tagar <itagar>
+ * @version 2.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the PointSet Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the PointSet Class.
+ * Declaring the PointSet Class, it's methods and fields.
+ * A PointSet class is a Set which holds Points and allows several operations associated with a Set.
+ * Copies of a PointSet share its storage with a reference count, and the storage is cloned only when
+ * one of them is modified.
+ * A small PointSet holds its Points inline, inside the object, and moves them to the heap only
+ * when it grows past the inline capacity. Copies of an inline PointSet copy its Points.
+ * A PointSet knows if its Points are in Morton (Z) order, which keeps Points that are close in the
+ * plane close in memory. Such a Set finds a Point with a binary search, and skips whole blocks of
+ * Points by their bounding boxes when it discards the interior of a polygon.
+ * A PointSet keeps its extreme Points, and so its bounding box, up to date, so it rejects the
+ * Points and the Sets which are outside its bounding box without scanning its Points.
+ * A PointSet caches its Convex Hull once it is requested, and keeps the cache while Points which
+ * do not change the Hull are added or removed.
+ */
+
+
+#ifndef EX1_POINTSET_H
+#define EX1_POINTSET_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <atomic>
+#include <vector>
+#include "Point.h"
+#include "PointKernels.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+#ifndef POINTSET_INLINE_CAPACITY
+/**
+ * @def POINTSET_INLINE_CAPACITY 16
+ * @brief A Macro that sets the number of Points which a PointSet holds inline, without heap
+ *        storage. It may be set at compile time, e.g. with '-DPOINTSET_INLINE_CAPACITY=32'.
+ */
+#define POINTSET_INLINE_CAPACITY 16
+#endif
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief PointP is a pointer to a Point.
+ */
+typedef Point *PointP;
+
+class PointSetView;
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a PointSet which contains several Points in it (without repetitions).
+ *        The PointSet holds several method which perform operations of a Set.
+ */
+class PointSet
+{
+public:
+
+    /**
+     * @brief The random-access iterator of the PointSet. The Points are read only, because a
+     *        change of a Point could break the Set.
+     */
+    typedef const Point *const_iterator;
+
+    /**
+     * @brief A Default Constructor for the PointSet, which create a new PointSet ready to
+     *        store Points.
+     */
+    PointSet();
+
+    /**
+     * @brief A Copy Constructor for the PointSet, which create a new PointSet ready to store Points
+     *        from a given PointSet data.
+     * @param other The PointSet to copy.
+     */
+    PointSet(const PointSet& other);
+
+    /**
+     * @brief A Constructor for the PointSet, which create a new PointSet from a given array of
+     *        distinct Points in O(n). The Points are not checked for repetitions, so this is the
+     *        way to hand over Points which are already known to be unique.
+     * @param points The array of distinct Points.
+     * @param count The number of Points in the array.
+     */
+    PointSet(const Point points[], int const count);
+
+    /**
+     * @brief A Destructor for the PointSet.
+     */
+    ~PointSet();
+
+    /**
+     * @brief Returns the size of the PointSet, i.e. the current number of elements.
+     * @return The size of the PointSet.
+     */
+    int size() const { return _size; };
+
+    /**
+     * @brief Returns the fingerprint of the PointSet, a hash of its Points which does not depend
+     *        on their order. Equal Sets have equal fingerprints.
+     * @return The fingerprint of the PointSet.
+     */
+    uint64_t fingerprint() const { return _fingerprint; };
+
+    /**
+     * @brief Checks if the Points of the PointSet are in Morton order, i.e. it was sorted by
+     *        sortByMorton, or it was built by adding the Points in that order.
+     * @return true if the Points are in Morton order.
+     */
+    bool isMortonOrdered() const { return _mortonOrdered; };
+
+    /**
+     * @brief Returns an iterator to the first Point of the PointSet.
+     *        The iterators are valid until the PointSet is modified.
+     * @return An iterator to the first Point.
+     */
+    const_iterator begin() const { return _pointSet; };
+
+    /**
+     * @brief Returns an iterator past the last Point of the PointSet.
+     * @return An iterator past the last Point.
+     */
+    const_iterator end() const { return _pointSet + _size; };
+
+    /**
+     * @brief Adds a given Point to the PointSet.
+     *        The new Point will be inserted to the end of the PointSet.
+     *        If the Point is already in the Set, this method will do nothing.
+     * @param point The new Point to insert.
+     * @return true if the insertion succeed, false otherwise.
+     */
+    bool add(const Point& point);
+
+    /**
+     * @brief Removes a given Point from the PointSet if exists, and updates the PointSet
+     *        accordingly. If the Point does not exist in the Set, this method will do nothing.
+     * @param point The Point to remove.
+     * @return true if the removal succeed, false otherwise.
+     */
+    bool remove(const Point& point);
+
+    /**
+     * @brief Represent the PointSet as a string for output use.
+     * @return A string representation of the PointSet.
+     */
+    std::string toString() const;
+
+    /**
+     * @brief Sort the PointSet according to the X coordinates.
+     */
+    void sortSet();
+
+    /**
+     * @brief Sort the PointSet according to the Polar Angles.
+     */
+    void sortByPolar();
+
+    /**
+     * @brief Sort the PointSet according to the Morton keys of the Points (the Z-order curve).
+     */
+    void sortByMorton();
+
+    /**
+     * @brief Returns the extreme Point of the given kind in the PointSet, which must not be empty,
+     *        in O(1).
+     * @param kind The kind of the extreme Point.
+     * @return The extreme Point.
+     */
+    const Point& extremePoint(ExtremePoint const kind) const;
+
+    /**
+     * @brief Checks in O(1) if a given Point is inside the bounding box of the PointSet, i.e. it
+     *        may be in the Set.
+     * @param point The Point to check.
+     * @return true if the Point is inside the bounding box, false if it is surely not in the Set.
+     */
+    bool mayContain(const Point& point) const;
+
+    /**
+     * @brief Returns the Convex Hull of the PointSet, without reordering it.
+     *        The Hull is calculated on the first call and cached: adding a Point updates the cache
+     *        in O(h) only if the Point is outside the Hull, and removing a Point drops the cache
+     *        only if it was a Hull Point. Sorting the PointSet keeps the cache.
+     *        Concurrent calls on an unchanged PointSet are safe.
+     * @return A PointSet which contains the Convex Hull Points, in Counter-Clockwise order starting
+     *         from the lowest Point.
+     */
+    PointSet convexHull() const;
+
+    /**
+     * @brief Removes all the Points which are strictly inside the given convex polygon.
+     *        The Points on the boundary of the polygon are kept, and the order of the remaining
+     *        Points does not change.
+     * @param polygon The corners of the polygon in Counter-Clockwise order.
+     * @param corners The number of corners of the polygon.
+     * @return The number of the removed Points.
+     */
+    int removeInterior(const Point polygon[], int const corners);
+
+    /**
+     * @brief An operator overload for the operator '[]' which gets the element in the
+     *        given index in the PointSet.
+     * @param index The required index in the PointSet.
+     * @return The element in the given index.
+     */
+    const Point& operator[](int const index) const;
+
+    /**
+     * @brief An operator overload for the comparison operator '==' which compares
+     *        this PointSet with another given PointSet.
+     * @param other A reference for the PointSet to compare to.
+     * @return true if both Sets contains the same elements, false otherwise.
+     */
+    bool operator==(const PointSet& other) const;
+
+    /**
+     * @brief An operator overload for the comparison operator '!=' which compares
+     *        this PointSet with another given PointSet.
+     * @param other A reference for the PointSet to compare to.
+     * @return true if the Sets does not contain the same elements, false otherwise.
+     */
+    bool operator!=(const PointSet& other) const;
+
+    /**
+     * @brief An operator overload for the subtract operator '-' which subtracts all the Points
+     *        that appears in the given PointSet from this PointSet.
+     * @param other A reference for the PointSet to subtract with.
+     * @return PointSet which include only the Points that appears in this PointSet
+     *         and not in the other PointSet.
+     */
+    PointSet operator-(const PointSet& other) const;
+
+    /**
+     * @brief An operator overload for the subtract operator '-' which subtracts all the Points
+     *        that appears in the given view from this PointSet.
+     * @param other A reference for the view to subtract with.
+     * @return PointSet which include only the Points that appears in this PointSet
+     *         and not in the view.
+     */
+    PointSet operator-(const PointSetView& other) const;
+
+    /**
+     * @brief An operator overload for the intersect operator '&' which intersect the Points
+     *        from this PointSet and the given PointSet.
+     * @param other A reference for the PointSet to intersect with.
+     * @return PointSet which include only the Points that appears both in this PointSet
+     *         and in the other PointSet.
+     */
+    PointSet operator&(const PointSet& other) const;
+
+    /**
+     * @brief An operator overload for the intersect operator '&' which intersect the Points
+     *        from this PointSet and the given view.
+     * @param other A reference for the view to intersect with.
+     * @return PointSet which include only the Points that appears both in this PointSet
+     *         and in the view.
+     */
+    PointSet operator&(const PointSetView& other) const;
+
+    /**
+     * @brief An operator overload for the assignment operator '=' which assign the given PointSet
+     *        to this PointSet.
+     * @param other A reference for the PointSet to assign it's data.
+     * @return The assigned PointSet with the required data.
+     */
+    PointSet& operator=(const PointSet& other);
+
+private:
+    // PointSet Private Fields.
+    int _size;  // The size of the PointSet, i.e. the current number of elements in the Set.
+    int _capacity;  // The capacity of the PointSet, i.e. the current maximum size to hold.
+    Point *_pointSet;  // The contiguous container for the Points data, inline or on the heap.
+    uint64_t _fingerprint;  // The sum of the hashes of the Points, updated on every change.
+    std::atomic<int> *_references;  // The number of PointSets which share the heap Points data.
+    bool _mortonOrdered;  // true if the Points are in Morton order.
+    mutable std::atomic<std::vector<Point> *> _hull;  // The cached Convex Hull, or null.
+    Point _extremes[EXTREME_POINT_KINDS];  // The extreme Point of every kind, if not empty.
+    Point _inlinePoints[POINTSET_INLINE_CAPACITY];  // The inline container for a small Set.
+
+    /**
+     * @brief Checks if the Points of this PointSet are held inline.
+     * @return true if the Points are inline, false if they are on the heap.
+     */
+    bool _isInline() const { return _pointSet == _inlinePoints; };
+
+    /**
+     * @brief Sets this PointSet to hold its Points inline, or in new heap storage if the given
+     *        capacity is larger than the inline capacity. The Points are not copied.
+     * @param capacity The required capacity.
+     */
+    void _allocateStorage(int const capacity);
+
+    /**
+     * @brief Releases the reference of this PointSet to its storage, and frees the storage if no
+     *        other PointSet shares it.
+     */
+    void _releaseStorage();
+
+    /**
+     * @brief Makes sure that this PointSet is the only owner of its storage before it is modified,
+     *        by cloning the storage if it is shared with other PointSets.
+     */
+    void _detach();
+
+    /**
+     * @brief Resize the PointSet capacity.
+     *        The Resize operation allocates memory for the new capacity, and copies all the data
+     *        from the current Set to the new larger Set.
+     */
+    void _resizePointSet();
+
+    /**
+     * @brief Finds the given Point in the PointSet if exists and return it's index in the Set.
+     *        If the given Point does not exist, returns INVALID_INDEX.
+     * @param point The Point to find.
+     * @return The index of the Point in the Set if exists, otherwise return INVALID_INDEX.
+     */
+    int _findPoint(const Point& point) const;
+
+    /**
+     * @brief Trims a gap in the PointSet which can occur during the removal operation.
+     *        This method moves each Point in the Set to the previous cell, starting from the given
+     *        index.
+     * @param gapIndex The index to start the trimming process from.
+     */
+    void _trimGap(int const gapIndex);
+
+    /**
+     * @brief Swap data between the 2 given PointSets.
+     * @param pointSet1 The first PointSet to swap.
+     * @param pointSet2 The second PointSet to swap.
+     */
+    void _swapData(PointSet& pointSet1, PointSet& pointSet2);
+
+    /**
+     * @brief Updates the extreme Points with a Point which is added to the PointSet.
+     *        The first Point of the Set is all of its extreme Points.
+     * @param point The added Point.
+     */
+    void _extendExtremes(const Point& point);
+
+    /**
+     * @brief Finds the extreme Points of the PointSet again, after one of them was removed.
+     */
+    void _findExtremes();
+
+    /**
+     * @brief Checks in O(1) if the bounding boxes of this PointSet and another PointSet overlap,
+     *        i.e. the Sets may have common Points.
+     * @param other The other PointSet.
+     * @return true if the bounding boxes overlap, false if the Sets surely have no common Point.
+     */
+    bool _boxesOverlap(const PointSet& other) const;
+
+    /**
+     * @brief Replaces the cached Convex Hull.
+     * @param hull The new cached Hull, or null to drop the cache.
+     */
+    void _setHull(std::vector<Point> *hull);
+
+    /**
+     * @brief Replaces the given Points, which may repeat, with their Convex Hull in
+     *        Counter-Clockwise order starting from the lowest Point, in O(n*log(n)).
+     * @param points The Points.
+     */
+    static void _reduceToHull(std::vector<Point>& points);
+
+    /**
+     * @brief Inserts a Point which is outside a Convex Hull into the Hull in O(h), keeping it in
+     *        Counter-Clockwise order starting from the lowest Point.
+     * @param hull The Hull.
+     * @param point The Point to insert.
+     */
+    static void _insertIntoHull(std::vector<Point>& hull, const Point& point);
+
+    // The union of Sets merges their cached Hulls.
+    friend PointSet unionAll(const std::vector<PointSetView>& sets, int const threads);
+};
+
+
+#endif //EX1_POINTSET_H
@@ -0,0 +1,234 @@
+/**
+ * @file PointSetInput.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the PointSet input handling implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the PointSet input handling implementation.
+ * Every line of the input holds a single Point in the format "X,Y".
+ * For the parallel input, the file is split to equal byte ranges, and each line belongs to the
+ * range in which it starts. Each thread reads its range with pread() (so the threads do not share
+ * a file offset), skips the line which started in the previous range and continues past the end
+ * of its range to complete its last line. The threads add the Points to a ConcurrentPointSet,
+ * which removes the repetitions between the ranges.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ConcurrentPointSet.h"
+#include "PointSetInput.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def START_INDEX 0
+ * @brief A Macro that sets the value for the start index in the input.
+ */
+#define START_INDEX 0
+
+/**
+ * @def END_OF_LINE '\n'
+ * @brief A Macro that sets the character which ends a line of the input.
+ */
+#define END_OF_LINE '\n'
+
+/**
+ * @def READ_BLOCK_SIZE (1 << 20)
+ * @brief A Macro that sets the number of bytes which a thread reads from the file at once.
+ */
+#define READ_BLOCK_SIZE (1 << 20)
+
+/**
+ * @def MINIMAL_RANGE_SIZE (1 << 16)
+ * @brief A Macro that sets the minimal number of bytes in the range of a single thread, so small
+ *        files are not split between many threads.
+ */
+#define MINIMAL_RANGE_SIZE (1 << 16)
+
+
+/*-----=  Input Handling  =-----*/
+
+
+/**
+ * @brief Initialize a new Point from a given user input.
+ * @param currentInput A string representing the user input, containing the X,Y coordinates.
+ * @return A Point with the requested data given from the user input.
+ */
+Point parsePoint(std::string const currentInput)
+{
+    // Parse the current input to the X,Y coordinates.
+    size_t delimiterIndex = currentInput.find(COORDINATES_SEPARATOR);
+    Coordinate x = parseCoordinate(currentInput.substr(START_INDEX, delimiterIndex));
+    Coordinate y = parseCoordinate(currentInput.substr(delimiterIndex + 1, std::string::npos));
+
+    // Create a new Point.
+    Point point(x, y);
+    return point;
+}
+
+/**
+ * @brief Handle the process of receiving input from the given stream and creating proper Points
+ *        from the given data to the PointSet.
+ * @param input The stream to read the "X,Y" lines from.
+ * @param pointSet The PointSet to add data to.
+ */
+void receiveInput(std::istream& input, PointSet& pointSet)
+{
+    std::string currentInput;
+    while (std::getline(input, currentInput))
+    {
+        // Create a new Point from the input.
+        Point point = parsePoint(currentInput);
+        pointSet.add(point);
+    }
+}
+
+/**
+ * @brief Parse all the lines which start in the given byte range of the file into the Set.
+ * @param fileDescriptor The file to read from.
+ * @param firstRange true if the range is the first range of the input.
+ * @param rangeStart The offset of the first byte of the range.
+ * @param rangeEnd The offset after the last byte of the range.
+ * @param fileEnd The offset of the end of the file.
+ * @param points The Set to add the parsed Points to.
+ */
+static void parseRange(int const fileDescriptor, bool const firstRange, off_t const rangeStart,
+                       off_t const rangeEnd, off_t const fileEnd, ConcurrentPointSet& points)
+{
+    std::vector<char> block(READ_BLOCK_SIZE);
+    std::string currentInput;
+
+    // Unless the previous byte ends a line, the first line started in the previous range, so we
+    // skip it until the end of that line.
+    off_t offset = rangeStart;
+    bool skipping = false;
+    if (!firstRange)
+    {
+        offset = rangeStart - 1;
+        skipping = true;
+    }
+
+    while (offset < fileEnd)
+    {
+        ssize_t count = pread(fileDescriptor, block.data(), block.size(), offset);
+        if (count <= 0)
+        {
+            break;
+        }
+        for (ssize_t i = 0; i < count; i++)
+        {
+            if (block[i] != END_OF_LINE)
+            {
+                if (!skipping)
+                {
+                    currentInput.push_back(block[i]);
+                }
+                continue;
+            }
+            if (!skipping)
+            {
+                points.add(parsePoint(currentInput));
+            }
+            skipping = false;
+            currentInput.clear();
+
+            // The next line belongs to the next range if it starts after the end of this range.
+            if (offset + i + 1 >= rangeEnd)
+            {
+                return;
+            }
+        }
+        offset += count;
+    }
+
+    // The last line of the file may not end with a new line.
+    if (!skipping && !currentInput.empty())
+    {
+        points.add(parsePoint(currentInput));
+    }
+}
+
+/**
+ * @brief Handle the process of receiving input from the given file with several threads.
+ *        The file (from its current offset to its end) is split to byte ranges which are aligned
+ *        to lines, and each thread parses the lines of a single range. The Points of all the
+ *        ranges are merged without repetitions into the PointSet.
+ *        Only regular files can be split, so for other files (e.g. pipes) this function does
+ *        nothing and returns false, and the input should be received with receiveInput().
+ *        A parsing error in any thread is thrown from this function after all threads end.
+ * @param fileDescriptor The file to read the "X,Y" lines from.
+ * @param threads The number of threads to parse with.
+ * @param pointSet The PointSet to add data to.
+ * @return true if the input was received, false if the file is not a regular file.
+ */
+bool receiveInputParallel(int const fileDescriptor, int const threads, PointSet& pointSet)
+{
+    struct stat status;
+    off_t fileStart = lseek(fileDescriptor, 0, SEEK_CUR);
+    if ((fstat(fileDescriptor, &status) != 0) || !S_ISREG(status.st_mode) || (fileStart < 0))
+    {
+        return false;
+    }
+    off_t fileEnd = status.st_size;
+    off_t length = std::max(fileEnd - fileStart, (off_t) 0);
+    int ranges = (int) std::min((off_t) threads, length / MINIMAL_RANGE_SIZE + 1);
+
+    // The Points which are already in the PointSet take part in the removal of repetitions.
+    ConcurrentPointSet points;
+    for (int i = 0; i < pointSet.size(); i++)
+    {
+        points.add(pointSet[i]);
+    }
+
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(ranges);
+    for (int range = 0; range < ranges; range++)
+    {
+        off_t rangeStart = fileStart + length * range / ranges;
+        off_t rangeEnd = fileStart + length * (range + 1) / ranges;
+        workers.emplace_back([=, &points, &errors]()
+                             {
+                                 try
+                                 {
+                                     parseRange(fileDescriptor, range == 0, rangeStart,
+                                                rangeEnd, fileEnd, points);
+                                 }
+                                 catch (...)
+                                 {
+                                     errors[range] = std::current_exception();
+                                 }
+                             });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // The file is consumed, as it would be by receiveInput().
+    lseek(fileDescriptor, fileEnd, SEEK_SET);
+    pointSet = points.toPointSet();
+    return true;
+}
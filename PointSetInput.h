@@ -0,0 +1,66 @@
+/**
+ * @file PointSetInput.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the PointSet input handling.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the PointSet input handling.
+ * Declaring the functions which parse the "X,Y" input format shared by the programs that are
+ * using the PointSet, and fill a PointSet with the parsed Points.
+ * A regular file may also be parsed by several threads, each one parsing a range of lines.
+ */
+
+
+#ifndef EX1_POINTSETINPUT_H
+#define EX1_POINTSETINPUT_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <istream>
+#include <string>
+#include "PointSet.h"
+
+
+/*-----=  Input Handling  =-----*/
+
+
+/**
+ * @brief Initialize a new Point from a given user input.
+ * @param currentInput A string representing the user input, containing the X,Y coordinates.
+ * @return A Point with the requested data given from the user input.
+ */
+Point parsePoint(std::string const currentInput);
+
+/**
+ * @brief Handle the process of receiving input from the given stream and creating proper Points
+ *        from the given data to the PointSet.
+ * @param input The stream to read the "X,Y" lines from.
+ * @param pointSet The PointSet to add data to.
+ */
+void receiveInput(std::istream& input, PointSet& pointSet);
+
+/**
+ * @brief Handle the process of receiving input from the given file with several threads.
+ *        The file (from its current offset to its end) is split to byte ranges which are aligned
+ *        to lines, and each thread parses the lines of a single range. The Points of all the
+ *        ranges are merged without repetitions into the PointSet.
+ *        Only regular files can be split, so for other files (e.g. pipes) this function does
+ *        nothing and returns false, and the input should be received with receiveInput().
+ *        A parsing error in any thread is thrown from this function after all threads end.
+ * @param fileDescriptor The file to read the "X,Y" lines from.
+ * @param threads The number of threads to parse with.
+ * @param pointSet The PointSet to add data to.
+ * @return true if the input was received, false if the file is not a regular file.
+ */
+bool receiveInputParallel(int const fileDescriptor, int const threads, PointSet& pointSet);
+
+
+#endif //EX1_POINTSETINPUT_H
@@ -0,0 +1,295 @@
+/**
+ * @file PointSetInstrumentation.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the latency instrumentation of the PointSet operations.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the latency instrumentation of the PointSet operations.
+ * Every thread registers its histograms in a global list on its first measurement, and adds them
+ * to the histograms of the ended threads when it ends. A thread is the only writer of its own
+ * histograms, so it updates them with relaxed loads and stores instead of atomic increments, and
+ * the atomics only let the dump read them safely while they change.
+ * Without the flag POINTSET_INSTRUMENTATION this file is empty.
+ */
+
+
+#if defined(POINTSET_INSTRUMENTATION)
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <vector>
+#include "PointSetInstrumentation.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def LATENCY_BUCKETS 40
+ * @brief A Macro that sets the number of buckets of a histogram. Bucket 0 counts the latencies of
+ *        0 nanoseconds, bucket i counts the latencies in [2^(i-1), 2^i) nanoseconds and the last
+ *        bucket counts all the longer latencies (about 4.5 minutes and above).
+ */
+#define LATENCY_BUCKETS 40
+
+/**
+ * @def LONG_LONG_BITS 64
+ * @brief A Macro that sets the number of bits of an unsigned long long.
+ */
+#define LONG_LONG_BITS 64
+
+/**
+ * @def HISTOGRAM_TITLE "PointSet latency histograms (nanoseconds):"
+ * @brief A Macro that sets the title of the dump.
+ */
+#define HISTOGRAM_TITLE "PointSet latency histograms (nanoseconds):"
+
+/**
+ * @def BUCKET_INDENT "    "
+ * @brief A Macro that sets the indentation of a bucket line in the dump.
+ */
+#define BUCKET_INDENT "    "
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The call count and the latency histogram of a single operation.
+ */
+struct LatencyHistogram
+{
+    std::atomic<uint64_t> calls;  // The number of calls.
+    std::atomic<uint64_t> nanoseconds;  // The total latency of the calls.
+    std::atomic<uint64_t> buckets[LATENCY_BUCKETS];  // The number of calls in every bucket.
+};
+
+/**
+ * @brief The histograms of all the operations, of a thread or of the ended threads.
+ */
+struct OperationHistograms
+{
+    LatencyHistogram operations[MEASURED_OPERATIONS];
+};
+
+
+/*-----=  Global Histograms  =-----*/
+
+
+/**
+ * @brief The names of the operations in the dump, in the order of MeasuredOperation.
+ */
+static const char *const gOperationNames[MEASURED_OPERATIONS] =
+        {"add", "remove", "_findPoint", "_resizePointSet", "operator==", "operator-", "operator&",
+         "unionAll", "intersectAll", "differenceAll"};
+
+/**
+ * @brief The histograms of the running threads, and the sum of the histograms of the ended ones.
+ *        It is never destroyed, so the threads which end after the static destructors still find
+ *        it.
+ */
+struct HistogramRegistry
+{
+    std::mutex lock;  // The lock which guards the list and the sum.
+    std::vector<OperationHistograms *> running;  // The histograms of the running threads.
+    OperationHistograms ended;  // The sum of the histograms of the ended threads.
+};
+
+/**
+ * @brief Prints the histograms of all the threads to the standard error, when the program exits.
+ */
+static void dumpAtExit()
+{
+    dumpInstrumentation(std::cerr);
+}
+
+/**
+ * @brief Returns the registry of the histograms, which is created on the first use.
+ * @return The registry.
+ */
+static HistogramRegistry& registry()
+{
+    static HistogramRegistry *registry = []()
+    {
+        std::atexit(dumpAtExit);
+        return new HistogramRegistry();
+    }();
+    return *registry;
+}
+
+/**
+ * @brief Adds a value to an atomic counter which only the calling thread changes.
+ * @param counter The counter.
+ * @param value The value to add.
+ */
+static void addToCounter(std::atomic<uint64_t>& counter, uint64_t const value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds the histograms of a thread to another histograms.
+ * @param source The histograms to add.
+ * @param target The histograms to add to.
+ */
+static void addHistograms(const OperationHistograms& source, OperationHistograms& target)
+{
+    for (int operation = 0; operation < MEASURED_OPERATIONS; operation++)
+    {
+        const LatencyHistogram& from = source.operations[operation];
+        LatencyHistogram& to = target.operations[operation];
+        addToCounter(to.calls, from.calls.load(std::memory_order_relaxed));
+        addToCounter(to.nanoseconds, from.nanoseconds.load(std::memory_order_relaxed));
+        for (int bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+        {
+            addToCounter(to.buckets[bucket], from.buckets[bucket].load(std::memory_order_relaxed));
+        }
+    }
+}
+
+
+/*-----=  Thread Histograms  =-----*/
+
+
+/**
+ * @brief The histograms of a single thread, which are registered while the thread runs.
+ */
+class ThreadHistograms
+{
+public:
+
+    /**
+     * @brief A Constructor for the histograms of the calling thread, which registers them.
+     */
+    ThreadHistograms() : _histograms()
+    {
+        HistogramRegistry& histograms = registry();
+        std::lock_guard<std::mutex> guard(histograms.lock);
+        histograms.running.push_back(&_histograms);
+    }
+
+    /**
+     * @brief A Destructor for the histograms of the calling thread, which adds them to the
+     *        histograms of the ended threads.
+     */
+    ~ThreadHistograms()
+    {
+        HistogramRegistry& histograms = registry();
+        std::lock_guard<std::mutex> guard(histograms.lock);
+        histograms.running.erase(std::find(histograms.running.begin(), histograms.running.end(),
+                                           &_histograms));
+        addHistograms(_histograms, histograms.ended);
+    }
+
+    /**
+     * @brief Returns the histogram of the given operation.
+     * @param operation The operation.
+     * @return The histogram.
+     */
+    LatencyHistogram& operator[](MeasuredOperation const operation)
+    {
+        return _histograms.operations[operation];
+    }
+
+private:
+    // ThreadHistograms Private Fields.
+    OperationHistograms _histograms;  // The histograms of the thread.
+};
+
+/**
+ * @brief The histograms of the current thread.
+ */
+static thread_local ThreadHistograms gThreadHistograms;
+
+
+/*-----=  Instrumentation Functions  =-----*/
+
+
+/**
+ * @brief Adds a call of the given operation and its latency to the histograms of this thread.
+ * @param operation The measured operation.
+ * @param nanoseconds The latency of the call.
+ */
+void recordLatency(MeasuredOperation const operation, uint64_t const nanoseconds)
+{
+    // The bucket of a latency is the number of its significant bits.
+    int bucket = (nanoseconds == 0) ? 0 : (LONG_LONG_BITS - __builtin_clzll(nanoseconds));
+    bucket = std::min(bucket, LATENCY_BUCKETS - 1);
+    LatencyHistogram& histogram = gThreadHistograms[operation];
+    addToCounter(histogram.calls, 1);
+    addToCounter(histogram.nanoseconds, nanoseconds);
+    addToCounter(histogram.buckets[bucket], 1);
+}
+
+/**
+ * @brief Prints the call counts and the latency histograms of all the threads, the threads which
+ *        ended included. The histograms of running threads are read while they are updated, so a
+ *        call which ends during the dump may be missing from it.
+ *        Every operation which was called is printed with its number of calls and its mean
+ *        latency, followed by a line for every bucket which is not empty.
+ * @param output The stream to print to.
+ */
+void dumpInstrumentation(std::ostream& output)
+{
+    OperationHistograms total{};
+    HistogramRegistry& histograms = registry();
+    {
+        std::lock_guard<std::mutex> guard(histograms.lock);
+        addHistograms(histograms.ended, total);
+        for (const OperationHistograms *thread : histograms.running)
+        {
+            addHistograms(*thread, total);
+        }
+    }
+
+    output << HISTOGRAM_TITLE << std::endl;
+    for (int operation = 0; operation < MEASURED_OPERATIONS; operation++)
+    {
+        const LatencyHistogram& histogram = total.operations[operation];
+        uint64_t calls = histogram.calls.load(std::memory_order_relaxed);
+        if (calls == 0)
+        {
+            continue;
+        }
+        output << gOperationNames[operation] << ": " << calls << " calls, mean "
+               << histogram.nanoseconds.load(std::memory_order_relaxed) / calls << std::endl;
+        for (int bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+        {
+            uint64_t count = histogram.buckets[bucket].load(std::memory_order_relaxed);
+            if (count == 0)
+            {
+                continue;
+            }
+            output << BUCKET_INDENT;
+            if (bucket == 0)
+            {
+                output << "[0, 1): ";
+            }
+            else if (bucket == LATENCY_BUCKETS - 1)
+            {
+                output << "[" << (1ULL << (bucket - 1)) << ", ...): ";
+            }
+            else
+            {
+                output << "[" << (1ULL << (bucket - 1)) << ", " << (1ULL << bucket) << "): ";
+            }
+            output << count << std::endl;
+        }
+    }
+}
+
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * @file PointSetInstrumentation.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the latency instrumentation of the PointSet operations.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the latency instrumentation of the PointSet operations.
+ * The instrumentation is compiled only with the flag POINTSET_INSTRUMENTATION ('make
+ * INSTRUMENTATION=1'). Then every measured operation counts its calls and its latencies in a
+ * histogram of power of 2 buckets of nanoseconds, kept by every thread in its own thread local
+ * storage, so the measurement takes no lock. The histograms of all threads are printed to the
+ * standard error when the program exits, or to any stream by 'dumpInstrumentation()'.
+ * Without the flag MEASURE_LATENCY() expands to nothing and 'dumpInstrumentation()' is an empty
+ * inline function, so the operations are compiled exactly as without the instrumentation.
+ */
+
+
+#ifndef EX1_POINTSETINSTRUMENTATION_H
+#define EX1_POINTSETINSTRUMENTATION_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <ostream>
+#if defined(POINTSET_INSTRUMENTATION)
+#include <chrono>
+#include <cstdint>
+#endif
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The measured operations.
+ */
+enum MeasuredOperation
+{
+    MEASURED_ADD,  // PointSet::add().
+    MEASURED_REMOVE,  // PointSet::remove().
+    MEASURED_FIND_POINT,  // PointSet::_findPoint().
+    MEASURED_RESIZE,  // PointSet::_resizePointSet().
+    MEASURED_EQUALITY,  // PointSet::operator==().
+    MEASURED_DIFFERENCE,  // PointSet::operator-(), of a PointSet or a view.
+    MEASURED_INTERSECTION,  // PointSet::operator&(), of a PointSet or a view.
+    MEASURED_UNION_ALL,  // unionAll().
+    MEASURED_INTERSECT_ALL,  // intersectAll().
+    MEASURED_DIFFERENCE_ALL,  // differenceAll().
+    MEASURED_OPERATIONS  // The number of measured operations.
+};
+
+
+#if defined(POINTSET_INSTRUMENTATION)
+
+
+/*-----=  Instrumentation Functions  =-----*/
+
+
+/**
+ * @brief Adds a call of the given operation and its latency to the histograms of this thread.
+ * @param operation The measured operation.
+ * @param nanoseconds The latency of the call.
+ */
+void recordLatency(MeasuredOperation const operation, uint64_t const nanoseconds);
+
+/**
+ * @brief Prints the call counts and the latency histograms of all the threads, the threads which
+ *        ended included. The histograms of running threads are read while they are updated, so a
+ *        call which ends during the dump may be missing from it.
+ * @param output The stream to print to.
+ */
+void dumpInstrumentation(std::ostream& output);
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class which measures the latency of its scope, and records it when it is destroyed.
+ */
+class LatencyTimer
+{
+public:
+
+    /**
+     * @brief A Constructor for a LatencyTimer, which starts the measurement.
+     * @param operation The measured operation.
+     */
+    explicit LatencyTimer(MeasuredOperation const operation)
+            : _operation(operation), _start(std::chrono::steady_clock::now())
+    {
+
+    }
+
+    /**
+     * @brief A LatencyTimer measures a single scope, so it can not be copied.
+     */
+    LatencyTimer(const LatencyTimer& other) = delete;
+
+    /**
+     * @brief A LatencyTimer measures a single scope, so it can not be assigned.
+     */
+    LatencyTimer& operator=(const LatencyTimer& other) = delete;
+
+    /**
+     * @brief A Destructor for the LatencyTimer, which records the latency of its scope.
+     */
+    ~LatencyTimer()
+    {
+        std::chrono::steady_clock::duration latency = std::chrono::steady_clock::now() - _start;
+        recordLatency(_operation, (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                latency).count());
+    }
+
+private:
+    // LatencyTimer Private Fields.
+    MeasuredOperation _operation;  // The measured operation.
+    std::chrono::steady_clock::time_point _start;  // The start of the measurement.
+};
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def MEASURE_LATENCY(operation) LatencyTimer latencyTimer(operation)
+ * @brief A Macro that measures the latency of the rest of the scope as the given operation.
+ */
+#define MEASURE_LATENCY(operation) LatencyTimer latencyTimer(operation)
+
+
+#else
+
+
+/**
+ * @def MEASURE_LATENCY(operation)
+ * @brief Without the instrumentation, a Macro that expands to nothing.
+ */
+#define MEASURE_LATENCY(operation)
+
+/**
+ * @brief Without the instrumentation, there is nothing to print.
+ */
+inline void dumpInstrumentation(std::ostream&)
+{
+
+}
+
+
+#endif
+
+
+#endif //EX1_POINTSETINSTRUMENTATION_H
@@ -0,0 +1,377 @@
+/**
+ * @file PointSetOperations.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the Set operations on many PointSets implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the Set operations on many PointSets implementation.
+ * All the operations count in a single pass, for every Point, the number of Sets which contain it
+ * (the Points of each Set are distinct) and whether the first Set contains it. The Points of the
+ * first Set are counted first, so the intersection and the difference only count the Points of the
+ * first Set, and the smallest Set is made the first one of an intersection.
+ * Large operations are split between threads by a partition of the hashes of the Points: every
+ * thread scatters a range of the Points to the partitions, and then every thread counts a single
+ * partition. A Point is in a single partition, so the results of the partitions are merged without
+ * checking them for repetitions.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+#include "PointSetInstrumentation.h"
+#include "PointSetOperations.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def PARALLEL_OPERATION_SIZE (1 << 17)
+ * @brief A Macro that sets the minimal total number of Points for splitting an operation between
+ *        threads.
+ */
+#define PARALLEL_OPERATION_SIZE (1 << 17)
+
+/**
+ * @def FIRST_SET 0
+ * @brief A Macro that sets the index of the first Set.
+ */
+#define FIRST_SET 0
+
+/**
+ * @def PARTITION_SHIFT 32
+ * @brief A Macro that sets the shift of the hash bits which select the partition, so they are
+ *        independent of the low bits which the hash tables use.
+ */
+#define PARTITION_SHIFT 32
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The Set operations.
+ */
+enum SetOperation
+{
+    UNION_OPERATION,
+    INTERSECTION_OPERATION,
+    DIFFERENCE_OPERATION
+};
+
+/**
+ * @brief A Point and the index of the Set which contains it.
+ */
+struct TaggedPoint
+{
+    Point point;  // The Point.
+    int set;  // The index of the Set.
+};
+
+/**
+ * @brief The Sets which contain a Point.
+ */
+struct Membership
+{
+    int sets;  // The number of Sets which contain the Point.
+    bool inFirst;  // true if the first Set contains the Point.
+};
+
+/**
+ * @brief A hash function object for the Points, which uses the hash of the Point.
+ */
+struct PointHash
+{
+    size_t operator()(const Point& point) const { return (size_t) point.hash(); };
+};
+
+/**
+ * @brief The Points of a single partition and the Sets which contain them, in the order of their
+ *        first appearance.
+ */
+struct PartitionCounter
+{
+    std::unordered_map<Point, Membership, PointHash> memberships;  // The Sets of every Point.
+    std::vector<Point> order;  // The Points in the order of their first appearance.
+};
+
+
+/*-----=  Counting Helpers  =-----*/
+
+
+/**
+ * @brief Counts a Point of a given Set.
+ *        For the intersection and the difference, a Point which is not in the first Set is not
+ *        counted at all, as it is never selected.
+ * @param counter The counter of the partition of the Point.
+ * @param point The Point.
+ * @param set The index of the Set which contains the Point.
+ * @param operation The Set operation.
+ */
+static void countPoint(PartitionCounter& counter, const Point& point, int const set,
+                       SetOperation const operation)
+{
+    if ((operation != UNION_OPERATION) && (set != FIRST_SET))
+    {
+        std::unordered_map<Point, Membership, PointHash>::iterator found =
+                counter.memberships.find(point);
+        if (found != counter.memberships.end())
+        {
+            found -> second.sets++;
+        }
+        return;
+    }
+
+    Membership& membership = counter.memberships[point];
+    if (membership.sets++ == 0)
+    {
+        membership.inFirst = (set == FIRST_SET);
+        counter.order.push_back(point);
+    }
+}
+
+/**
+ * @brief Appends the counted Points which are selected by the Set operation to the result.
+ * @param counter The counter of a partition.
+ * @param operation The Set operation.
+ * @param setCount The number of Sets.
+ * @param result The result Points to append to.
+ */
+static void selectPoints(const PartitionCounter& counter, SetOperation const operation,
+                         int const setCount, std::vector<Point>& result)
+{
+    for (const Point& point : counter.order)
+    {
+        const Membership& membership = counter.memberships.at(point);
+        if ((operation == UNION_OPERATION) ||
+            ((operation == INTERSECTION_OPERATION) && (membership.sets == setCount)) ||
+            ((operation == DIFFERENCE_OPERATION) && membership.inFirst && (membership.sets == 1)))
+        {
+            result.push_back(point);
+        }
+    }
+}
+
+
+/*-----=  Set Operations Implementation  =-----*/
+
+
+/**
+ * @brief Calculate a Set operation with a single thread.
+ * @param sets The Sets.
+ * @param operation The Set operation.
+ * @param totalSize The total number of Points in the Sets.
+ * @return The result Points.
+ */
+static std::vector<Point> operateSerial(const std::vector<PointSetView>& sets,
+                                        SetOperation const operation, long const totalSize)
+{
+    PartitionCounter counter;
+    counter.memberships.reserve((operation == UNION_OPERATION) ? totalSize :
+                                sets[FIRST_SET].size());
+    for (int set = FIRST_SET; set < (int) sets.size(); set++)
+    {
+        for (const Point& point : sets[set])
+        {
+            countPoint(counter, point, set, operation);
+        }
+    }
+    std::vector<Point> result;
+    selectPoints(counter, operation, (int) sets.size(), result);
+    return result;
+}
+
+/**
+ * @brief Calculate a Set operation with the given number of threads, each one counting a single
+ *        partition of the Points.
+ * @param sets The Sets.
+ * @param operation The Set operation.
+ * @param totalSize The total number of Points in the Sets.
+ * @param threads The number of threads, which is also the number of partitions.
+ * @return The result Points.
+ */
+static std::vector<Point> operateParallel(const std::vector<PointSetView>& sets,
+                                          SetOperation const operation, long const totalSize,
+                                          int const threads)
+{
+    // The offset of every Set in the sequence of all the Points.
+    std::vector<long> offsets(sets.size() + 1, 0);
+    for (size_t set = 0; set < sets.size(); set++)
+    {
+        offsets[set + 1] = offsets[set] + sets[set].size();
+    }
+
+    // Every thread scatters a range of the sequence to its own bucket of every partition, so the
+    // buckets of a partition keep the order of the sequence (the first Set comes first).
+    std::vector<std::vector<TaggedPoint>> buckets(threads * threads);
+    std::vector<std::thread> workers;
+    for (int thread = 0; thread < threads; thread++)
+    {
+        workers.emplace_back([&, thread]()
+        {
+            long first = totalSize * thread / threads;
+            long last = totalSize * (thread + 1) / threads;
+            int set = (int) (std::upper_bound(offsets.begin(), offsets.end(), first) -
+                             offsets.begin()) - 1;
+            for (long index = first; index < last; index++)
+            {
+                while (index >= offsets[set + 1])
+                {
+                    set++;
+                }
+                const Point& point = sets[set][(int) (index - offsets[set])];
+                int partition = (int) ((point.hash() >> PARTITION_SHIFT) % threads);
+                buckets[thread * threads + partition].push_back({point, set});
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    workers.clear();
+
+    // Every thread counts a single partition.
+    std::vector<std::vector<Point>> results(threads);
+    for (int partition = 0; partition < threads; partition++)
+    {
+        workers.emplace_back([&, partition]()
+        {
+            PartitionCounter counter;
+            for (int thread = 0; thread < threads; thread++)
+            {
+                for (const TaggedPoint& tagged : buckets[thread * threads + partition])
+                {
+                    countPoint(counter, tagged.point, tagged.set, operation);
+                }
+            }
+            selectPoints(counter, operation, (int) sets.size(), results[partition]);
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    // The partitions are disjoint, so they are merged without checking for repetitions.
+    std::vector<Point> result;
+    for (const std::vector<Point>& partitionResult : results)
+    {
+        result.insert(result.end(), partitionResult.begin(), partitionResult.end());
+    }
+    return result;
+}
+
+/**
+ * @brief Calculate a Set operation, with several threads if the Sets are large enough.
+ * @param sets The Sets.
+ * @param operation The Set operation.
+ * @param threads The number of threads, HARDWARE_THREADS for all the hardware threads.
+ * @return A PointSet with the result Points.
+ */
+static PointSet operate(const std::vector<PointSetView>& sets, SetOperation const operation,
+                        int threads)
+{
+    if (sets.empty() || ((operation != UNION_OPERATION) && (sets[FIRST_SET].size() == 0)))
+    {
+        return PointSet();
+    }
+    long totalSize = 0;
+    for (PointSetView set : sets)
+    {
+        totalSize += set.size();
+    }
+
+    if (threads == HARDWARE_THREADS)
+    {
+        threads = (int) std::thread::hardware_concurrency();
+    }
+    std::vector<Point> result = ((totalSize < PARALLEL_OPERATION_SIZE) || (threads <= 1)) ?
+                                operateSerial(sets, operation, totalSize) :
+                                operateParallel(sets, operation, totalSize, threads);
+    return PointSet(result.data(), (int) result.size());
+}
+
+
+/*-----=  Set Operations  =-----*/
+
+
+/**
+ * @brief Calculate the union of the given Sets, i.e. the Points which are in any of them.
+ * @param sets The Sets (PointSets may be given, as they are converted to views).
+ * @param threads The number of threads for large Sets, HARDWARE_THREADS for all the hardware ones.
+ * @return A PointSet with the Points of the union, in an unspecified order.
+ */
+PointSet unionAll(const std::vector<PointSetView>& sets, int const threads)
+{
+    MEASURE_LATENCY(MEASURED_UNION_ALL);
+
+    PointSet result = operate(sets, UNION_OPERATION, threads);
+
+    // The Hull of the union is the Hull of the union of the Hulls.
+    std::vector<Point> hull;
+    for (PointSetView const set : sets)
+    {
+        const std::vector<Point> *setHull = (set.wholeSet() == nullptr) ? nullptr :
+                                            set.wholeSet() -> _hull.load(std::memory_order_acquire);
+        if (setHull == nullptr)
+        {
+            return result;
+        }
+        hull.insert(hull.end(), setHull -> begin(), setHull -> end());
+    }
+    PointSet::_reduceToHull(hull);
+    result._setHull(new std::vector<Point>(std::move(hull)));
+    return result;
+}
+
+/**
+ * @brief Calculate the intersection of the given Sets, i.e. the Points which are in all of them.
+ *        The smallest Set is counted first, so only its Points are counted.
+ * @param sets The Sets (PointSets may be given, as they are converted to views).
+ * @param threads The number of threads for large Sets, HARDWARE_THREADS for all the hardware ones.
+ * @return A PointSet with the Points of the intersection, in an unspecified order. It is empty if
+ *         no Sets are given.
+ */
+PointSet intersectAll(const std::vector<PointSetView>& sets, int const threads)
+{
+    MEASURE_LATENCY(MEASURED_INTERSECT_ALL);
+
+    std::vector<PointSetView> ordered(sets);
+    std::vector<PointSetView>::iterator smallest =
+            std::min_element(ordered.begin(), ordered.end(),
+                             [](PointSetView const set1, PointSetView const set2)
+                             {
+                                 return set1.size() < set2.size();
+                             });
+    if (smallest != ordered.end())
+    {
+        std::iter_swap(ordered.begin(), smallest);
+    }
+    return operate(ordered, INTERSECTION_OPERATION, threads);
+}
+
+/**
+ * @brief Calculate the difference of the first given Set and all the other given Sets, i.e. the
+ *        Points of the first Set which are in none of the others.
+ * @param sets The Sets (PointSets may be given, as they are converted to views).
+ * @param threads The number of threads for large Sets, HARDWARE_THREADS for all the hardware ones.
+ * @return A PointSet with the Points of the difference, in an unspecified order. It is empty if
+ *         no Sets are given.
+ */
+PointSet differenceAll(const std::vector<PointSetView>& sets, int const threads)
+{
+    MEASURE_LATENCY(MEASURED_DIFFERENCE_ALL);
+
+    return operate(sets, DIFFERENCE_OPERATION, threads);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file PointSetOperations.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the Set operations on many PointSets.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Set operations on many PointSets.
+ * Declaring the functions which calculate the union, the intersection and the difference of any
+ * number of PointSets (or views) in a single pass, instead of a chain of binary operators which
+ * creates a temporary PointSet at every step.
+ */
+
+
+#ifndef EX1_POINTSETOPERATIONS_H
+#define EX1_POINTSETOPERATIONS_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include "PointSetView.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def HARDWARE_THREADS 0
+ * @brief A Macro that sets the number of threads which stands for the number of hardware threads.
+ */
+#define HARDWARE_THREADS 0
+
+
+/*-----=  Set Operations  =-----*/
+
+
+/**
+ * @brief Calculate the union of the given Sets, i.e. the Points which are in any of them.
+ *        If all the Sets are whole PointSets with cached Convex Hulls, the cached Hull of the union
+ *        is merged from their Hulls.
+ * @param sets The Sets (PointSets may be given, as they are converted to views).
+ * @param threads The number of threads for large Sets, HARDWARE_THREADS for all the hardware ones.
+ * @return A PointSet with the Points of the union, in an unspecified order.
+ */
+PointSet unionAll(const std::vector<PointSetView>& sets, int const threads = HARDWARE_THREADS);
+
+/**
+ * @brief Calculate the intersection of the given Sets, i.e. the Points which are in all of them.
+ * @param sets The Sets (PointSets may be given, as they are converted to views).
+ * @param threads The number of threads for large Sets, HARDWARE_THREADS for all the hardware ones.
+ * @return A PointSet with the Points of the intersection, in an unspecified order. It is empty if
+ *         no Sets are given.
+ */
+PointSet intersectAll(const std::vector<PointSetView>& sets, int const threads = HARDWARE_THREADS);
+
+/**
+ * @brief Calculate the difference of the first given Set and all the other given Sets, i.e. the
+ *        Points of the first Set which are in none of the others.
+ * @param sets The Sets (PointSets may be given, as they are converted to views).
+ * @param threads The number of threads for large Sets, HARDWARE_THREADS for all the hardware ones.
+ * @return A PointSet with the Points of the difference, in an unspecified order. It is empty if
+ *         no Sets are given.
+ */
+PointSet differenceAll(const std::vector<PointSetView>& sets, int const threads = HARDWARE_THREADS);
+
+
+#endif //EX1_POINTSETOPERATIONS_H
@@ -0,0 +1,257 @@
+/**
+ * @file PointSetSnapshot.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the binary snapshots of a PointSet implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the binary snapshots of a PointSet implementation.
+ * A Point is exactly its 2 coordinates, so the Points of a PointSet are written as they are in
+ * memory, and the Points of a MappedPointSet are used directly from the mapping.
+ * The header is 16 bytes long and the mapping starts on a page, so the Points are aligned.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "PointSetSnapshot.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def INT16_SNAPSHOT 1
+ * @brief A Macro that sets the Coordinate type value of 16 bits coordinates.
+ */
+#define INT16_SNAPSHOT 1
+
+/**
+ * @def INT32_SNAPSHOT 2
+ * @brief A Macro that sets the Coordinate type value of 32 bits coordinates.
+ */
+#define INT32_SNAPSHOT 2
+
+/**
+ * @def INT64_SNAPSHOT 3
+ * @brief A Macro that sets the Coordinate type value of 64 bits coordinates.
+ */
+#define INT64_SNAPSHOT 3
+
+/**
+ * @def DOUBLE_SNAPSHOT 4
+ * @brief A Macro that sets the Coordinate type value of floating point coordinates.
+ */
+#define DOUBLE_SNAPSHOT 4
+
+#if defined(COORDINATE_INT16)
+/**
+ * @def COORDINATE_SNAPSHOT
+ * @brief A Macro that sets the Coordinate type value of this program.
+ */
+#define COORDINATE_SNAPSHOT INT16_SNAPSHOT
+#elif defined(COORDINATE_INT64)
+#define COORDINATE_SNAPSHOT INT64_SNAPSHOT
+#elif defined(COORDINATE_DOUBLE)
+#define COORDINATE_SNAPSHOT DOUBLE_SNAPSHOT
+#else
+#define COORDINATE_SNAPSHOT INT32_SNAPSHOT
+#endif
+
+/**
+ * @def NO_FLAGS 0
+ * @brief A Macro that sets the flags of a snapshot without any flag.
+ */
+#define NO_FLAGS 0
+
+/**
+ * @def FIRST_INDEX 0
+ * @brief A Macro that sets the index of the first Point.
+ */
+#define FIRST_INDEX 0
+
+
+static_assert(sizeof(Point) == 2 * sizeof(Coordinate), "A Point must be exactly 2 coordinates");
+static_assert(sizeof(SnapshotHeader) == 16, "The snapshot header must be 16 bytes long");
+
+
+/*-----=  Snapshot Headers  =-----*/
+
+
+/**
+ * @brief Creates the header of a snapshot of Points with the Coordinate type of this program.
+ * @param count The number of Points in the snapshot.
+ * @param flags The flags of the snapshot, e.g. SORTED_SNAPSHOT.
+ * @return The header.
+ */
+SnapshotHeader createSnapshotHeader(uint64_t const count, uint8_t const flags)
+{
+    SnapshotHeader header;
+    memcpy(header.magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE);
+    header.version = SNAPSHOT_VERSION;
+    header.coordinateType = COORDINATE_SNAPSHOT;
+    header.flags = flags;
+    header.count = count;
+    return header;
+}
+
+/**
+ * @brief Checks if a given header is the header of a snapshot which this program can read, i.e.
+ *        of the current version and with the Coordinate type of this program.
+ * @param header The header to check.
+ * @return true if the header is valid, false otherwise.
+ */
+bool isValidSnapshotHeader(const SnapshotHeader& header)
+{
+    return (memcmp(header.magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE) == 0) &&
+           (header.version == SNAPSHOT_VERSION) && (header.coordinateType == COORDINATE_SNAPSHOT);
+}
+
+
+/*-----=  Snapshot Writing  =-----*/
+
+
+/**
+ * @brief Writes a given PointSet as a snapshot to the given file.
+ *        The snapshot is marked as sorted if the Points of the PointSet are sorted by their X and
+ *        then Y coordinates (e.g. after sortSet()).
+ * @param pointSet The PointSet to write.
+ * @param path The path of the snapshot file.
+ * @return true if the snapshot was written, false otherwise.
+ */
+bool writeSnapshot(const PointSet& pointSet, const std::string& path)
+{
+    SnapshotHeader header = createSnapshotHeader((uint64_t) pointSet.size(), SORTED_SNAPSHOT);
+    for (int i = 1; i < pointSet.size(); i++)
+    {
+        if (!pointSet[i - 1].lessByX(pointSet[i]))
+        {
+            header.flags = NO_FLAGS;
+            break;
+        }
+    }
+
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    output.write((const char *) &header, sizeof(header));
+    if (pointSet.size() > 0)
+    {
+        // The Points of the PointSet are contiguous.
+        output.write((const char *) &pointSet[FIRST_INDEX], pointSet.size() * sizeof(Point));
+    }
+    output.close();
+    return !output.fail();
+}
+
+
+/*-----=  MappedPointSet Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the MappedPointSet, which maps the given snapshot file.
+ *        Throws std::runtime_error if the file can not be mapped or it is not a valid snapshot
+ *        of Points with the Coordinate type of this program.
+ * @param path The path of the snapshot file.
+ */
+MappedPointSet::MappedPointSet(const std::string& path)
+{
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw std::runtime_error("Can not open the snapshot " + path);
+    }
+    struct stat status;
+    if ((fstat(fileDescriptor, &status) != 0) ||
+        (status.st_size < (off_t) sizeof(SnapshotHeader)))
+    {
+        close(fileDescriptor);
+        throw std::runtime_error("Invalid snapshot " + path);
+    }
+    _length = (size_t) status.st_size;
+    _mapping = mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (_mapping == MAP_FAILED)
+    {
+        throw std::runtime_error("Can not map the snapshot " + path);
+    }
+
+    // Validate the header against the format and the size of the file.
+    const SnapshotHeader *header = (const SnapshotHeader *) _mapping;
+    if (!isValidSnapshotHeader(*header) || (header -> count > INT_MAX) ||
+        (_length != sizeof(SnapshotHeader) + header -> count * sizeof(Point)))
+    {
+        munmap(_mapping, _length);
+        throw std::runtime_error("Invalid snapshot " + path);
+    }
+    _points = (const Point *) (header + 1);
+    _size = (int) header -> count;
+    _sorted = (header -> flags & SORTED_SNAPSHOT) != 0;
+}
+
+/**
+ * @brief A Destructor for the MappedPointSet, which unmaps the snapshot.
+ */
+MappedPointSet::~MappedPointSet()
+{
+    munmap(_mapping, _length);
+}
+
+
+/*-----=  MappedPointSet Methods  =-----*/
+
+
+/**
+ * @brief Checks if a given Point is in the MappedPointSet, with a binary search if the Points
+ *        are sorted or a scan otherwise.
+ * @param point The Point to find.
+ * @return true if the Point is in the MappedPointSet, false otherwise.
+ */
+bool MappedPointSet::contains(const Point& point) const
+{
+    if (_sorted)
+    {
+        return std::binary_search(_points, _points + _size, point,
+                                  [](const Point& point1, const Point& point2)
+                                  {
+                                      return point1.lessByX(point2);
+                                  });
+    }
+    return findPointIndex(_points, _size, point) != POINT_NOT_FOUND;
+}
+
+/**
+ * @brief Copies the Points to an ordinary PointSet, in O(n).
+ * @return A PointSet which holds all the Points.
+ */
+PointSet MappedPointSet::toPointSet() const
+{
+    // The Points of a snapshot are distinct.
+    return PointSet(_points, _size);
+}
+
+/**
+ * @brief An operator overload for the operator '[]' which gets the element in the
+ *        given index in the MappedPointSet.
+ * @param index The required index in the MappedPointSet.
+ * @return The element in the given index.
+ */
+const Point& MappedPointSet::operator[](int const index) const
+{
+    assert(index >= FIRST_INDEX && index < _size);
+    return _points[index];
+}
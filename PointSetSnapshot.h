@@ -0,0 +1,199 @@
+/**
+ * @file PointSetSnapshot.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the binary snapshots of a PointSet.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the binary snapshots of a PointSet.
+ * Declaring the snapshot format, the function which writes a PointSet as a snapshot and the
+ * MappedPointSet Class, a read-only view of a snapshot which is mapped to memory.
+ * A snapshot holds a SnapshotHeader followed by the packed coordinates (X and then Y) of each
+ * Point, in the byte order of the machine. The Points of a snapshot are always distinct (they come
+ * from a PointSet), and the SORTED_SNAPSHOT flag marks Points which are also sorted by their X
+ * and then Y coordinates.
+ */
+
+
+#ifndef EX1_POINTSETSNAPSHOT_H
+#define EX1_POINTSETSNAPSHOT_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "PointSet.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def SNAPSHOT_MAGIC "PSET"
+ * @brief A Macro that sets the bytes which open every snapshot.
+ */
+#define SNAPSHOT_MAGIC "PSET"
+
+/**
+ * @def SNAPSHOT_MAGIC_SIZE 4
+ * @brief A Macro that sets the number of bytes in the magic of a snapshot.
+ */
+#define SNAPSHOT_MAGIC_SIZE 4
+
+/**
+ * @def SNAPSHOT_VERSION 1
+ * @brief A Macro that sets the version of the snapshot format.
+ */
+#define SNAPSHOT_VERSION 1
+
+/**
+ * @def SORTED_SNAPSHOT 1
+ * @brief A Macro that sets the flag of a snapshot whose Points are sorted by their X and then Y
+ *        coordinates.
+ */
+#define SORTED_SNAPSHOT 1
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The header of a snapshot.
+ */
+struct SnapshotHeader
+{
+    char magic[SNAPSHOT_MAGIC_SIZE];  // The SNAPSHOT_MAGIC bytes.
+    uint16_t version;  // The version of the format, SNAPSHOT_VERSION.
+    uint8_t coordinateType;  // The Coordinate type of the Points.
+    uint8_t flags;  // The flags of the snapshot, e.g. SORTED_SNAPSHOT.
+    uint64_t count;  // The number of Points in the snapshot.
+};
+
+
+/*-----=  Snapshot Headers  =-----*/
+
+
+/**
+ * @brief Creates the header of a snapshot of Points with the Coordinate type of this program.
+ * @param count The number of Points in the snapshot.
+ * @param flags The flags of the snapshot, e.g. SORTED_SNAPSHOT.
+ * @return The header.
+ */
+SnapshotHeader createSnapshotHeader(uint64_t const count, uint8_t const flags);
+
+/**
+ * @brief Checks if a given header is the header of a snapshot which this program can read, i.e.
+ *        of the current version and with the Coordinate type of this program.
+ * @param header The header to check.
+ * @return true if the header is valid, false otherwise.
+ */
+bool isValidSnapshotHeader(const SnapshotHeader& header);
+
+
+/*-----=  Snapshot Writing  =-----*/
+
+
+/**
+ * @brief Writes a given PointSet as a snapshot to the given file.
+ *        The snapshot is marked as sorted if the Points of the PointSet are sorted by their X and
+ *        then Y coordinates (e.g. after sortSet()).
+ * @param pointSet The PointSet to write.
+ * @param path The path of the snapshot file.
+ * @return true if the snapshot was written, false otherwise.
+ */
+bool writeSnapshot(const PointSet& pointSet, const std::string& path);
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a read-only view of a snapshot, which is mapped to memory.
+ *        The Points are used in place, without copying them or checking them for repetitions.
+ */
+class MappedPointSet
+{
+public:
+
+    /**
+     * @brief A Constructor for the MappedPointSet, which maps the given snapshot file.
+     *        Throws std::runtime_error if the file can not be mapped or it is not a valid snapshot
+     *        of Points with the Coordinate type of this program.
+     * @param path The path of the snapshot file.
+     */
+    explicit MappedPointSet(const std::string& path);
+
+    /**
+     * @brief The MappedPointSet owns its mapping, so it can not be copied.
+     */
+    MappedPointSet(const MappedPointSet& other) = delete;
+
+    /**
+     * @brief The MappedPointSet owns its mapping, so it can not be assigned.
+     */
+    MappedPointSet& operator=(const MappedPointSet& other) = delete;
+
+    /**
+     * @brief A Destructor for the MappedPointSet, which unmaps the snapshot.
+     */
+    ~MappedPointSet();
+
+    /**
+     * @brief Returns the size of the MappedPointSet, i.e. the number of Points.
+     * @return The size of the MappedPointSet.
+     */
+    int size() const { return _size; };
+
+    /**
+     * @brief Returns whether the Points are sorted by their X and then Y coordinates.
+     * @return true if the Points are sorted, false otherwise.
+     */
+    bool isSorted() const { return _sorted; };
+
+    /**
+     * @brief Returns the contiguous array of the Points.
+     * @return The Points.
+     */
+    const Point *points() const { return _points; };
+
+    /**
+     * @brief Checks if a given Point is in the MappedPointSet, with a binary search if the Points
+     *        are sorted or a scan otherwise.
+     * @param point The Point to find.
+     * @return true if the Point is in the MappedPointSet, false otherwise.
+     */
+    bool contains(const Point& point) const;
+
+    /**
+     * @brief Copies the Points to an ordinary PointSet, in O(n).
+     * @return A PointSet which holds all the Points.
+     */
+    PointSet toPointSet() const;
+
+    /**
+     * @brief An operator overload for the operator '[]' which gets the element in the
+     *        given index in the MappedPointSet.
+     * @param index The required index in the MappedPointSet.
+     * @return The element in the given index.
+     */
+    const Point& operator[](int const index) const;
+
+private:
+    // MappedPointSet Private Fields.
+    void *_mapping;  // The start of the mapped snapshot.
+    size_t _length;  // The number of mapped bytes.
+    const Point *_points;  // The Points inside the mapping.
+    int _size;  // The number of Points.
+    bool _sorted;  // Whether the Points are sorted by their X and then Y coordinates.
+};
+
+
+#endif //EX1_POINTSETSNAPSHOT_H
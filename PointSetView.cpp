@@ -0,0 +1,180 @@
+/**
+ * @file PointSetView.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the PointSetView Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the PointSetView Class implementation.
+ * Define the PointSetView Class methods and fields.
+ * The Points of a view are distinct, so the result of a Set operation on views is built without
+ * checking it for repetitions.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cassert>
+#include <vector>
+#include "PointSetView.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def EMPTY_VIEW_SIZE 0
+ * @brief A Macro that sets the size for an empty view.
+ */
+#define EMPTY_VIEW_SIZE 0
+
+
+/*-----=  PointSetView Constructors  =-----*/
+
+
+/**
+ * @brief A Default Constructor for the PointSetView, which create an empty view.
+ */
+PointSetView::PointSetView() : _points(nullptr), _size(EMPTY_VIEW_SIZE), _mortonOrdered(true),
+                               _wholeSet(nullptr)
+{
+
+}
+
+/**
+ * @brief A Constructor for the PointSetView, which views all the Points of a given PointSet.
+ *        The conversion is implicit, so a PointSet may be passed wherever a view is expected.
+ * @param pointSet The PointSet to view.
+ */
+PointSetView::PointSetView(const PointSet& pointSet) : _points(pointSet.begin()),
+                                                       _size(pointSet.size()),
+                                                       _mortonOrdered(pointSet.isMortonOrdered()),
+                                                       _wholeSet(&pointSet)
+{
+
+}
+
+/**
+ * @brief A Constructor for the PointSetView, which views a range of a given PointSet.
+ * @param pointSet The PointSet to view.
+ * @param first The index of the first Point of the range.
+ * @param count The number of Points in the range.
+ */
+PointSetView::PointSetView(const PointSet& pointSet, int const first, int const count)
+        : _points(pointSet.begin() + first), _size(count),
+          _mortonOrdered(pointSet.isMortonOrdered()),
+          _wholeSet((first == EMPTY_VIEW_SIZE) && (count == pointSet.size()) ? &pointSet : nullptr)
+{
+    assert(first >= EMPTY_VIEW_SIZE && count >= EMPTY_VIEW_SIZE &&
+           first + count <= pointSet.size());
+}
+
+/**
+ * @brief A Constructor for the PointSetView, which views a given array of distinct Points.
+ * @param points The array of distinct Points.
+ * @param count The number of Points in the array.
+ */
+PointSetView::PointSetView(const Point points[], int const count) : _points(points), _size(count),
+                                                                   _mortonOrdered(false),
+                                                                   _wholeSet(nullptr)
+{
+
+}
+
+
+/*-----=  PointSetView Methods  =-----*/
+
+
+/**
+ * @brief Returns a view of a range of this view.
+ * @param first The index of the first Point of the range.
+ * @param count The number of Points in the range.
+ * @return The view of the range.
+ */
+PointSetView PointSetView::subView(int const first, int const count) const
+{
+    assert(first >= EMPTY_VIEW_SIZE && count >= EMPTY_VIEW_SIZE && first + count <= _size);
+    PointSetView range(_points + first, count);
+    range._mortonOrdered = _mortonOrdered;
+    range._wholeSet = (count == _size) ? _wholeSet : nullptr;
+    return range;
+}
+
+/**
+ * @brief Checks if a given Point is in the view.
+ *        A view in Morton order is searched with a binary search.
+ * @param point The Point to find.
+ * @return true if the Point is in the view, false otherwise.
+ */
+bool PointSetView::contains(const Point& point) const
+{
+    int index = _mortonOrdered ? findMortonIndex(_points, _size, point) :
+                findPointIndex(_points, _size, point);
+    return index != POINT_NOT_FOUND;
+}
+
+/**
+ * @brief Collects the Points of this view which are (or are not) in the given view.
+ * @param other The view to check the Points against.
+ * @param inOther true to collect the Points which are in the other view, false to collect the
+ *        Points which are not.
+ * @return A PointSet with the collected Points, in the order of this view.
+ */
+PointSet PointSetView::_select(PointSetView const other, bool const inOther) const
+{
+    std::vector<Point> selected;
+    for (const Point& point : *this)
+    {
+        if (other.contains(point) == inOther)
+        {
+            selected.push_back(point);
+        }
+    }
+    return PointSet(selected.data(), (int) selected.size());
+}
+
+
+/*-----=  PointSetView Operators Overload  =-----*/
+
+
+/**
+ * @brief An operator overload for the operator '[]' which gets the element in the
+ *        given index in the view.
+ * @param index The required index in the view.
+ * @return The element in the given index.
+ */
+const Point& PointSetView::operator[](int const index) const
+{
+    assert(index >= EMPTY_VIEW_SIZE && index < _size);
+    return _points[index];
+}
+
+/**
+ * @brief An operator overload for the subtract operator '-' which subtracts all the Points
+ *        that appears in the given view from this view.
+ * @param other The view to subtract with.
+ * @return PointSet which include only the Points that appears in this view and not in the
+ *         other view.
+ */
+PointSet PointSetView::operator-(PointSetView const other) const
+{
+    return _select(other, false);
+}
+
+/**
+ * @brief An operator overload for the intersect operator '&' which intersect the Points
+ *        from this view and the given view.
+ * @param other The view to intersect with.
+ * @return PointSet which include only the Points that appears both in this view and in the
+ *         other view.
+ */
+PointSet PointSetView::operator&(PointSetView const other) const
+{
+    return _select(other, true);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file PointSetView.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the PointSetView Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the PointSetView Class.
+ * Declaring the PointSetView Class, it's methods and fields.
+ * A PointSetView is a non-owning view of a contiguous range of distinct Points, e.g. a range of a
+ * PointSet, which allows to pass a part of a Set to an algorithm without copying it.
+ * A view is valid as long as the Points it views are not modified.
+ * A view of a PointSet in Morton order is in Morton order too, and finds a Point with a binary
+ * search, so the Set operations with it as the other operand take O(n*log(m)).
+ */
+
+
+#ifndef EX1_POINTSETVIEW_H
+#define EX1_POINTSETVIEW_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "PointSet.h"
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a non-owning view of a contiguous range of distinct Points.
+ *        The view is as cheap to copy as a pointer and a size, so it is passed by value.
+ */
+class PointSetView
+{
+public:
+
+    /**
+     * @brief The random-access iterator of the view.
+     */
+    typedef PointSet::const_iterator const_iterator;
+
+    /**
+     * @brief A Default Constructor for the PointSetView, which create an empty view.
+     */
+    PointSetView();
+
+    /**
+     * @brief A Constructor for the PointSetView, which views all the Points of a given PointSet.
+     *        The conversion is implicit, so a PointSet may be passed wherever a view is expected.
+     * @param pointSet The PointSet to view.
+     */
+    PointSetView(const PointSet& pointSet);
+
+    /**
+     * @brief A Constructor for the PointSetView, which views a range of a given PointSet.
+     * @param pointSet The PointSet to view.
+     * @param first The index of the first Point of the range.
+     * @param count The number of Points in the range.
+     */
+    PointSetView(const PointSet& pointSet, int const first, int const count);
+
+    /**
+     * @brief A Constructor for the PointSetView, which views a given array of distinct Points.
+     * @param points The array of distinct Points.
+     * @param count The number of Points in the array.
+     */
+    PointSetView(const Point points[], int const count);
+
+    /**
+     * @brief Returns the size of the view, i.e. the number of Points in it.
+     * @return The size of the view.
+     */
+    int size() const { return _size; };
+
+    /**
+     * @brief Checks if the Points of the view are in Morton order.
+     * @return true if the Points are in Morton order.
+     */
+    bool isMortonOrdered() const { return _mortonOrdered; };
+
+    /**
+     * @brief Returns the viewed PointSet if the view covers all of its Points.
+     * @return The viewed PointSet, or null for a view of a part of a PointSet or of an array.
+     */
+    const PointSet *wholeSet() const { return _wholeSet; };
+
+    /**
+     * @brief Returns an iterator to the first Point of the view.
+     * @return An iterator to the first Point.
+     */
+    const_iterator begin() const { return _points; };
+
+    /**
+     * @brief Returns an iterator past the last Point of the view.
+     * @return An iterator past the last Point.
+     */
+    const_iterator end() const { return _points + _size; };
+
+    /**
+     * @brief Returns a view of a range of this view.
+     * @param first The index of the first Point of the range.
+     * @param count The number of Points in the range.
+     * @return The view of the range.
+     */
+    PointSetView subView(int const first, int const count) const;
+
+    /**
+     * @brief Checks if a given Point is in the view.
+     * @param point The Point to find.
+     * @return true if the Point is in the view, false otherwise.
+     */
+    bool contains(const Point& point) const;
+
+    /**
+     * @brief An operator overload for the operator '[]' which gets the element in the
+     *        given index in the view.
+     * @param index The required index in the view.
+     * @return The element in the given index.
+     */
+    const Point& operator[](int const index) const;
+
+    /**
+     * @brief An operator overload for the subtract operator '-' which subtracts all the Points
+     *        that appears in the given view from this view.
+     * @param other The view to subtract with.
+     * @return PointSet which include only the Points that appears in this view and not in the
+     *         other view.
+     */
+    PointSet operator-(PointSetView const other) const;
+
+    /**
+     * @brief An operator overload for the intersect operator '&' which intersect the Points
+     *        from this view and the given view.
+     * @param other The view to intersect with.
+     * @return PointSet which include only the Points that appears both in this view and in the
+     *         other view.
+     */
+    PointSet operator&(PointSetView const other) const;
+
+private:
+    // PointSetView Private Fields.
+    const Point *_points;  // The first Point of the view.
+    int _size;  // The number of Points in the view.
+    bool _mortonOrdered;  // true if the Points are in Morton order.
+    const PointSet *_wholeSet;  // The viewed PointSet if the view covers all of it, or null.
+
+    /**
+     * @brief Collects the Points of this view which are (or are not) in the given view.
+     * @param other The view to check the Points against.
+     * @param inOther true to collect the Points which are in the other view, false to collect the
+     *        Points which are not.
+     * @return A PointSet with the collected Points, in the order of this view.
+     */
+    PointSet _select(PointSetView const other, bool const inOther) const;
+};
+
+
+#endif //EX1_POINTSETVIEW_H
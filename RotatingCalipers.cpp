@@ -0,0 +1,276 @@
+/**
+ * @file RotatingCalipers.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the Rotating Calipers analytics implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the Rotating Calipers analytics implementation.
+ * Each function walks on the edges of the Convex Hull in Counter-Clockwise order, and keeps
+ * pointers to the Hull Points which are extreme with respect to the current edge.
+ * Because the Hull is convex, each pointer only moves forward, so every pointer passes on the
+ * Hull at most a constant number of times and the total running time is O(h).
+ * Reference:
+ *     "Toussaint - Solving Geometric Problems with the Rotating Calipers", 1983.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cmath>
+#include "RotatingCalipers.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def FIRST_INDEX 0
+ * @brief A Macro that sets the index of the first Point of the Hull.
+ */
+#define FIRST_INDEX 0
+
+/**
+ * @def SINGLE_POINT_HULL 1
+ * @brief A Macro that sets the size of a Hull which contains a single Point.
+ */
+#define SINGLE_POINT_HULL 1
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief Product is the type of an exact product of coordinates differences.
+ */
+typedef CoordinateProduct Product;
+
+/**
+ * @brief Difference is the type of an exact difference of coordinates.
+ */
+typedef CoordinateDifference Difference;
+
+
+/*-----=  Calipers Helpers  =-----*/
+
+
+/**
+ * @brief Returns the index which follows the given index in the Counter-Clockwise order.
+ * @param index The current index.
+ * @param size The size of the Hull.
+ * @return The next index.
+ */
+static int nextIndex(int const index, int const size)
+{
+    return (index + 1) % size;
+}
+
+/**
+ * @brief Calculates the cross product of the vectors (edgeEnd - edgeStart) and (point - base).
+ * @param edgeStart The start of the edge.
+ * @param edgeEnd The end of the edge.
+ * @param base The start of the second vector.
+ * @param point The end of the second vector.
+ * @return The cross product.
+ */
+static Product cross(const Point& edgeStart, const Point& edgeEnd, const Point& base,
+                     const Point& point)
+{
+    return (Product) ((Difference) edgeEnd.getX() - edgeStart.getX())
+                     * ((Difference) point.getY() - base.getY())
+           - (Product) ((Difference) edgeEnd.getY() - edgeStart.getY())
+                       * ((Difference) point.getX() - base.getX());
+}
+
+/**
+ * @brief Calculates the dot product of the vectors (edgeEnd - edgeStart) and (point - base).
+ * @param edgeStart The start of the edge.
+ * @param edgeEnd The end of the edge.
+ * @param base The start of the second vector.
+ * @param point The end of the second vector.
+ * @return The dot product.
+ */
+static Product dot(const Point& edgeStart, const Point& edgeEnd, const Point& base,
+                   const Point& point)
+{
+    return (Product) ((Difference) edgeEnd.getX() - edgeStart.getX())
+                     * ((Difference) point.getX() - base.getX())
+           + (Product) ((Difference) edgeEnd.getY() - edgeStart.getY())
+                       * ((Difference) point.getY() - base.getY());
+}
+
+/**
+ * @brief Advance the given pointer to the Hull Point which is the farthest from the line of the
+ *        given edge (the antipodal Point of the edge).
+ * @param hull The Convex Hull in Counter-Clockwise order.
+ * @param edgeIndex The index of the start of the edge.
+ * @param pointer The pointer to advance.
+ */
+static void advanceToAntipodal(const PointSet& hull, int const edgeIndex, int& pointer)
+{
+    const Point& edgeStart = hull[edgeIndex];
+    const Point& edgeEnd = hull[nextIndex(edgeIndex, hull.size())];
+    while (cross(edgeStart, edgeEnd, edgeStart, hull[nextIndex(pointer, hull.size())]) >
+           cross(edgeStart, edgeEnd, edgeStart, hull[pointer]))
+    {
+        pointer = nextIndex(pointer, hull.size());
+    }
+}
+
+
+/*-----=  Rotating Calipers  =-----*/
+
+
+/**
+ * @brief Calculates the diameter of the given Convex Hull.
+ *        The farthest pair is always an antipodal pair, and each edge has its antipodal Point
+ *        found by the calipers, so we only check these pairs.
+ * @param hull A non empty Convex Hull in Counter-Clockwise order.
+ * @return The farthest pair of Points of the Hull.
+ */
+HullDiameter getHullDiameter(const PointSet& hull)
+{
+    HullDiameter result = {hull[FIRST_INDEX], hull[FIRST_INDEX], 0};
+    Product bestDistance = 0;
+
+    int antipodal = nextIndex(FIRST_INDEX, hull.size());
+    for (int i = 0; (hull.size() > SINGLE_POINT_HULL) && (i < hull.size()); i++)
+    {
+        advanceToAntipodal(hull, i, antipodal);
+
+        // The antipodal Point is checked against both ends of the current edge.
+        int ends[] = {i, nextIndex(i, hull.size())};
+        for (int end : ends)
+        {
+            Product distance = dot(hull[end], hull[antipodal], hull[end], hull[antipodal]);
+            if (distance > bestDistance)
+            {
+                bestDistance = distance;
+                result.first = hull[end];
+                result.second = hull[antipodal];
+            }
+        }
+    }
+
+    result.length = std::sqrt((double) bestDistance);
+    return result;
+}
+
+/**
+ * @brief Calculates the minimum width of the given Convex Hull.
+ *        The minimum width is achieved by a line which contains an edge of the Hull, so for each
+ *        edge we measure the distance to its antipodal Point.
+ * @param hull A non empty Convex Hull in Counter-Clockwise order.
+ * @return The minimum width of the Hull.
+ */
+HullWidth getHullWidth(const PointSet& hull)
+{
+    HullWidth result = {hull[FIRST_INDEX], hull[FIRST_INDEX], hull[FIRST_INDEX], 0};
+    bool found = false;
+
+    int antipodal = nextIndex(FIRST_INDEX, hull.size());
+    for (int i = 0; (hull.size() > SINGLE_POINT_HULL) && (i < hull.size()); i++)
+    {
+        advanceToAntipodal(hull, i, antipodal);
+
+        const Point& edgeStart = hull[i];
+        const Point& edgeEnd = hull[nextIndex(i, hull.size())];
+        double width = cross(edgeStart, edgeEnd, edgeStart, hull[antipodal]) /
+                       std::sqrt((double) dot(edgeStart, edgeEnd, edgeStart, edgeEnd));
+        if (!found || (width < result.width))
+        {
+            found = true;
+            result.edgeStart = edgeStart;
+            result.edgeEnd = edgeEnd;
+            result.opposite = hull[antipodal];
+            result.width = width;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calculates the minimum area bounding rectangle of the given Convex Hull.
+ *        The minimum rectangle has a side which contains an edge of the Hull, so for each edge we
+ *        keep 3 calipers: the farthest Point along the edge, the farthest Point from the edge line
+ *        and the farthest Point against the edge direction.
+ * @param hull A non empty Convex Hull in Counter-Clockwise order.
+ * @return The minimum area rectangle which encloses the Hull.
+ */
+BoundingRectangle getMinimumBoundingRectangle(const PointSet& hull)
+{
+    BoundingRectangle result;
+    for (int corner = 0; corner < RECTANGLE_CORNERS; corner++)
+    {
+        result.cornersX[corner] = hull[FIRST_INDEX].getX();
+        result.cornersY[corner] = hull[FIRST_INDEX].getY();
+    }
+    result.area = 0;
+    if (hull.size() == SINGLE_POINT_HULL)
+    {
+        return result;
+    }
+
+    bool found = false;
+    int right = nextIndex(FIRST_INDEX, hull.size());  // Farthest along the edge.
+    int top = 0;  // Farthest from the edge line.
+    int left = 0;  // Farthest against the edge direction.
+    for (int i = 0; i < hull.size(); i++)
+    {
+        const Point& edgeStart = hull[i];
+        const Point& edgeEnd = hull[nextIndex(i, hull.size())];
+
+        while (dot(edgeStart, edgeEnd, hull[right], hull[nextIndex(right, hull.size())]) > 0)
+        {
+            right = nextIndex(right, hull.size());
+        }
+        if (i == FIRST_INDEX)
+        {
+            top = right;
+        }
+        advanceToAntipodal(hull, i, top);
+        if (i == FIRST_INDEX)
+        {
+            left = top;
+        }
+        while (dot(edgeStart, edgeEnd, hull[left], hull[nextIndex(left, hull.size())]) < 0)
+        {
+            left = nextIndex(left, hull.size());
+        }
+
+        // Measure the rectangle in units of the edge vector.
+        double squaredLength = dot(edgeStart, edgeEnd, edgeStart, edgeEnd);
+        double leftExtent = dot(edgeStart, edgeEnd, edgeStart, hull[left]) / squaredLength;
+        double rightExtent = dot(edgeStart, edgeEnd, edgeStart, hull[right]) / squaredLength;
+        double height = cross(edgeStart, edgeEnd, edgeStart, hull[top]) / squaredLength;
+        double area = (rightExtent - leftExtent) * height * squaredLength;
+        if (found && (area >= result.area))
+        {
+            continue;
+        }
+        found = true;
+        result.area = area;
+
+        // The corners are the base Point moved along the edge, and then along its normal.
+        double edgeX = (double) edgeEnd.getX() - edgeStart.getX();
+        double edgeY = (double) edgeEnd.getY() - edgeStart.getY();
+        double extents[] = {leftExtent, rightExtent, rightExtent, leftExtent};
+        double heights[] = {0, 0, height, height};
+        for (int corner = 0; corner < RECTANGLE_CORNERS; corner++)
+        {
+            result.cornersX[corner] = edgeStart.getX() + extents[corner] * edgeX
+                                      - heights[corner] * edgeY;
+            result.cornersY[corner] = edgeStart.getY() + extents[corner] * edgeY
+                                      + heights[corner] * edgeX;
+        }
+    }
+
+    return result;
+}
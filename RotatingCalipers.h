@@ -0,0 +1,103 @@
+/**
+ * @file RotatingCalipers.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the Rotating Calipers analytics of a Convex Hull.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Rotating Calipers analytics of a Convex Hull.
+ * Declaring the results and the functions which calculate the diameter, the minimum width and the
+ * minimum area bounding rectangle of a Convex Hull.
+ * All the functions receive the Convex Hull as a PointSet in Counter-Clockwise order (as it is
+ * returned from the Convex Hull calculation, before any sorting), and run in linear time.
+ */
+
+
+#ifndef EX1_ROTATINGCALIPERS_H
+#define EX1_ROTATINGCALIPERS_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "PointSet.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def RECTANGLE_CORNERS 4
+ * @brief A Macro that sets the number of corners in a rectangle.
+ */
+#define RECTANGLE_CORNERS 4
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief The diameter of a Convex Hull, i.e. the farthest pair of its Points.
+ */
+struct HullDiameter
+{
+    Point first;  // The first Point of the farthest pair.
+    Point second;  // The second Point of the farthest pair.
+    double length;  // The distance between the Points.
+};
+
+/**
+ * @brief The minimum width of a Convex Hull, i.e. the minimal distance between 2 parallel lines
+ *        which enclose the Hull. One of the lines always contains an edge of the Hull.
+ */
+struct HullWidth
+{
+    Point edgeStart;  // The first Point of the Hull edge which lies on one of the lines.
+    Point edgeEnd;  // The second Point of the Hull edge which lies on one of the lines.
+    Point opposite;  // The Hull Point which lies on the other line.
+    double width;  // The distance between the lines.
+};
+
+/**
+ * @brief The minimum area rectangle which encloses a Convex Hull.
+ *        The corners are not necessarily integral, and are given in Counter-Clockwise order.
+ */
+struct BoundingRectangle
+{
+    double cornersX[RECTANGLE_CORNERS];  // The X coordinates of the corners.
+    double cornersY[RECTANGLE_CORNERS];  // The Y coordinates of the corners.
+    double area;  // The area of the rectangle.
+};
+
+
+/*-----=  Rotating Calipers  =-----*/
+
+
+/**
+ * @brief Calculates the diameter of the given Convex Hull.
+ * @param hull A non empty Convex Hull in Counter-Clockwise order.
+ * @return The farthest pair of Points of the Hull.
+ */
+HullDiameter getHullDiameter(const PointSet& hull);
+
+/**
+ * @brief Calculates the minimum width of the given Convex Hull.
+ * @param hull A non empty Convex Hull in Counter-Clockwise order.
+ * @return The minimum width of the Hull.
+ */
+HullWidth getHullWidth(const PointSet& hull);
+
+/**
+ * @brief Calculates the minimum area bounding rectangle of the given Convex Hull.
+ * @param hull A non empty Convex Hull in Counter-Clockwise order.
+ * @return The minimum area rectangle which encloses the Hull.
+ */
+BoundingRectangle getMinimumBoundingRectangle(const PointSet& hull);
+
+
+#endif //EX1_ROTATINGCALIPERS_H
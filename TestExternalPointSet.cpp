@@ -0,0 +1,264 @@
+/**
+ * @file TestExternalPointSet.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Test for the ExternalPointSet Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Test for the ExternalPointSet Class.
+ * Random overlapping Sets are added to ExternalPointSets in parts, through every kind of input
+ * (single Points, text lines, sorted snapshots and unsorted snapshots) and with repetitions, and
+ * the snapshots which the operations write are compared to the operators of the PointSets. The
+ * Sets are large enough to spill the buffer of the smallest memory budget, and they have more
+ * sorted snapshots than the budget merges at once, so the runs are merged in groups first. A Set
+ * of a single sorted snapshot is read in place, and the union replaces that snapshot.
+ * The files of the test are kept in a temporary directory which is removed at the end.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "ExternalPointSet.h"
+#include "PointSetSnapshot.h"
+#include "TestSupport.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def SPILL_SIZE (3 * MINIMAL_EXTERNAL_MEMORY / 2 / sizeof(Point))
+ * @brief A Macro that sets the number of single Points which are added to a Set, which is more
+ *        than the buffer of the smallest memory budget holds.
+ */
+#define SPILL_SIZE (3 * MINIMAL_EXTERNAL_MEMORY / 2 / sizeof(Point))
+
+/**
+ * @def PART_SIZE 5000
+ * @brief A Macro that sets the number of Points in every other part of a Set.
+ */
+#define PART_SIZE 5000
+
+/**
+ * @def SORTED_PARTS 5
+ * @brief A Macro that sets the number of sorted snapshots of a Set, which is more than the
+ *        smallest memory budget merges at once.
+ */
+#define SORTED_PARTS 5
+
+/**
+ * @def REPEAT_PROBABILITY 0.1
+ * @brief A Macro that sets the probability of a Point of a Set to be added again in another part.
+ */
+#define REPEAT_PROBABILITY 0.1
+
+/**
+ * @def TEMPORARY_DIRECTORY "TestExternalPointSet.XXXXXX"
+ * @brief A Macro that sets the template of the temporary directory of the test.
+ */
+#define TEMPORARY_DIRECTORY "TestExternalPointSet.XXXXXX"
+
+
+/*-----=  Test Helpers  =-----*/
+
+
+/**
+ * @brief Draws a random Set from a pool of Points, and adds it to an ExternalPointSet in parts:
+ *        single Points, text lines, sorted snapshots and an unsorted snapshot. Some Points are
+ *        added again in a later part.
+ * @param random The random generator.
+ * @param pool The distinct Points to draw from.
+ * @param directory The directory of the snapshots of the parts.
+ * @param name The name of the Set, which prefixes the names of its snapshots.
+ * @param external The ExternalPointSet to add the Set to.
+ * @return The distinct Points of the Set.
+ */
+static std::vector<Point> addRandomSet(std::mt19937& random, const std::vector<Point>& pool,
+                                       const std::string& directory, const std::string& name,
+                                       ExternalPointSet& external)
+{
+    std::bernoulli_distribution repeat(REPEAT_PROBABILITY);
+    std::vector<Point> points = randomSubset(random, pool);
+
+    // Every part starts with some Points of the previous parts.
+    std::vector<Point>::const_iterator next = points.begin();
+    std::vector<Point> part;
+    auto nextPart = [&](size_t const size)
+    {
+        part.clear();
+        for (std::vector<Point>::const_iterator point = points.begin(); point != next; ++point)
+        {
+            if (repeat(random))
+            {
+                part.push_back(*point);
+            }
+        }
+        size_t count = std::min(size, (size_t) (points.end() - next));
+        part.insert(part.end(), next, next + count);
+        next += count;
+    };
+
+    nextPart(SPILL_SIZE);
+    for (const Point& point : part)
+    {
+        external.add(point);
+    }
+
+    nextPart(PART_SIZE);
+    std::stringstream lines;
+    for (const Point& point : part)
+    {
+        lines << point.toString() << std::endl;
+    }
+    external.addLines(lines);
+
+    for (int sorted = 0; sorted <= SORTED_PARTS; sorted++)
+    {
+        // The last snapshot is the rest of the Set, and it is not sorted.
+        nextPart((sorted < SORTED_PARTS) ? PART_SIZE : points.size());
+        sortDistinct(part);
+        if (sorted == SORTED_PARTS)
+        {
+            std::shuffle(part.begin(), part.end(), random);
+        }
+        PointSet partSet(part.data(), (int) part.size());
+        std::string path = directory + "/" + name + std::to_string(sorted);
+        writeSnapshot(partSet, path);
+        external.addSnapshot(path);
+    }
+    return points;
+}
+
+/**
+ * @brief Checks a snapshot which an operation wrote against the expected Points.
+ * @param name The name of the test.
+ * @param path The path of the snapshot.
+ * @param written The number of Points which the operation returned.
+ * @param expected The expected Points, sorted by their X and then Y coordinates.
+ * @return true if the snapshot is right, false otherwise.
+ */
+static bool checkSnapshot(const std::string& name, const std::string& path, uint64_t const written,
+                          const std::vector<Point>& expected)
+{
+    MappedPointSet snapshot(path);
+    std::vector<Point> points(snapshot.points(), snapshot.points() + snapshot.size());
+    if (!snapshot.isSorted() || (written != points.size()))
+    {
+        std::cout << "ERROR: Fail test " << name << " (" << written << " Points returned, "
+                  << (snapshot.isSorted() ? "sorted" : "not sorted") << ")" << std::endl;
+        return false;
+    }
+    return checkPoints(name, points, expected);
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The Main function that runs the test.
+ * @return 0 when all the tests passed, otherwise return a non-zero number.
+ */
+int main()
+{
+    char directoryTemplate[] = TEMPORARY_DIRECTORY;
+    if (mkdtemp(directoryTemplate) == nullptr)
+    {
+        std::cout << "ERROR: Can not create the directory " << TEMPORARY_DIRECTORY << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::string directory = directoryTemplate;
+    std::vector<std::string> files;
+    for (const char *set : {"A", "B"})
+    {
+        for (int part = 0; part <= SORTED_PARTS; part++)
+        {
+            files.push_back(directory + "/" + set + std::to_string(part));
+        }
+    }
+    std::string whole1 = directory + "/A";
+    std::string whole2 = directory + "/B";
+    std::string output = directory + "/result";
+    files.insert(files.end(), {whole1, whole2, output});
+
+    std::mt19937 random(TEST_SEED);
+    bool passed = true;
+    try
+    {
+        std::vector<Point> pool = randomPool(random, (int) ((SPILL_SIZE + (SORTED_PARTS + 2) *
+                                                             PART_SIZE) / SET_PROBABILITY));
+        ExternalPointSet external1(MINIMAL_EXTERNAL_MEMORY, directory);
+        ExternalPointSet external2(MINIMAL_EXTERNAL_MEMORY, directory);
+        std::vector<Point> points1 = addRandomSet(random, pool, directory, "A", external1);
+        std::vector<Point> points2 = addRandomSet(random, pool, directory, "B", external2);
+
+        // The expected results are found by the operators of the PointSets.
+        PointSet set1(points1.data(), (int) points1.size());
+        PointSet set2(points2.data(), (int) points2.size());
+        set2.sortByMorton();
+        std::vector<Point> expected;
+        for (bool const intersect : {true, false})
+        {
+            PointSet result = intersect ? (set1 & set2) : (set1 - set2);
+            expected.assign(result.begin(), result.end());
+            sortPoints(expected);
+            ExternalOperation operation = intersect ? EXTERNAL_INTERSECTION : EXTERNAL_DIFFERENCE;
+            passed &= checkSnapshot(intersect ? "intersection" : "difference", output,
+                                    external1.writeOperation(external2, operation, output),
+                                    expected);
+        }
+
+        expected = points1;
+        expected.insert(expected.end(), points2.begin(), points2.end());
+        sortDistinct(expected);
+        passed &= checkSnapshot("union", output,
+                                external1.writeOperation(external2, EXTERNAL_UNION, output),
+                                expected);
+
+        // A Set of a single sorted snapshot reads it in place, and the union replaces it.
+        set1.sortSet();
+        set2.sortSet();
+        writeSnapshot(set1, whole1);
+        writeSnapshot(set2, whole2);
+        ExternalPointSet snapshot1(MINIMAL_EXTERNAL_MEMORY, directory);
+        ExternalPointSet snapshot2(MINIMAL_EXTERNAL_MEMORY, directory);
+        snapshot1.addSnapshot(whole1);
+        snapshot2.addSnapshot(whole2);
+        passed &= checkSnapshot("union in place", whole1,
+                                snapshot1.writeOperation(snapshot2, EXTERNAL_UNION, whole1),
+                                expected);
+    }
+    catch (const std::exception& error)
+    {
+        std::cout << "ERROR: Fail test " << error.what() << std::endl;
+        passed = false;
+    }
+
+    for (const std::string& file : files)
+    {
+        std::remove(file.c_str());
+    }
+    rmdir(directory.c_str());
+
+    if (!passed)
+    {
+        return EXIT_FAILURE;
+    }
+    std::cout << "Pass ExternalPointSet tests." << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,226 @@
+/**
+ * @file TestFrozenPointSet.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Test for the FrozenPointSet Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Test for the FrozenPointSet Class.
+ * Random Sets are frozen and compared to their Points: the iteration, the thawed PointSet, the
+ * membership tests and the '-', '&' and '==' operators. The Sets have sizes around the block size,
+ * and their Points are either dense (many equal X coordinates and small deltas) or spread over the
+ * whole range of the Coordinate type (the largest deltas).
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "FrozenPointSet.h"
+#include "TestSupport.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def DENSE_RANGE 200
+ * @brief A Macro that sets the range of the coordinates of dense Points.
+ */
+#define DENSE_RANGE 200
+
+/**
+ * @def EXTREME_PROBABILITY 0.1
+ * @brief A Macro that sets the probability of a spread coordinate to be an extreme of its type.
+ */
+#define EXTREME_PROBABILITY 0.1
+
+/**
+ * @def POOL_FACTOR 2
+ * @brief A Macro that sets the size of the pool of Points relative to the size of the first Set.
+ */
+#define POOL_FACTOR 2
+
+/**
+ * @def EQUAL_SET_SIZE 1000
+ * @brief A Macro that sets the maximal size of the Set which is compared to itself.
+ */
+#define EQUAL_SET_SIZE 1000
+
+
+/*-----=  Test Helpers  =-----*/
+
+
+/**
+ * @brief Draws a random coordinate. A spread coordinate is in [-COORDINATE_RANGE,
+ *        COORDINATE_RANGE], or an extreme of the Coordinate type.
+ * @param random The random generator.
+ * @param dense true for a coordinate of a dense Set, false for a spread one.
+ * @return The coordinate.
+ */
+static Coordinate randomCoordinate(std::mt19937& random, bool const dense)
+{
+    if (dense)
+    {
+        return (Coordinate) std::uniform_int_distribution<int>(-DENSE_RANGE, DENSE_RANGE)(random);
+    }
+    if (std::bernoulli_distribution(EXTREME_PROBABILITY)(random))
+    {
+        return std::bernoulli_distribution()(random) ? std::numeric_limits<Coordinate>::lowest() :
+               std::numeric_limits<Coordinate>::max();
+    }
+    std::uniform_int_distribution<int> coordinate(-COORDINATE_RANGE, COORDINATE_RANGE);
+    return (Coordinate) coordinate(random);
+}
+
+/**
+ * @brief Draws distinct random dense or spread Points.
+ * @param random The random generator.
+ * @param count The maximal number of Points.
+ * @param dense true for dense Points, false for spread ones.
+ * @return The distinct Points, in a random order.
+ */
+static std::vector<Point> drawPool(std::mt19937& random, int const count, bool const dense)
+{
+    return randomPool(random, count, [&]()
+                      {
+                          return randomCoordinate(random, dense);
+                      });
+}
+
+/**
+ * @brief Checks the Points of a FrozenPointSet, in their order, against the expected Points.
+ * @param name The name of the test.
+ * @param frozen The FrozenPointSet.
+ * @param expected The expected Points, sorted by their X and then Y coordinates.
+ * @return true if the Points are right, false otherwise.
+ */
+static bool checkFrozenPoints(const std::string& name, const FrozenPointSet& frozen,
+                              const std::vector<Point>& expected)
+{
+    if (frozen.size() != (int) expected.size())
+    {
+        std::cout << "ERROR: Fail test size of " << name << std::endl;
+        return false;
+    }
+    return checkPoints(name, std::vector<Point>(frozen.begin(), frozen.end()), expected);
+}
+
+/**
+ * @brief Checks the FrozenPointSets of 2 overlapping Sets against their Points.
+ * @param name The name of the Sets.
+ * @param set1 The first Set.
+ * @param set2 The second Set.
+ * @param others Points which are not in the first Set.
+ * @return true if all the checks passed, false otherwise.
+ */
+static bool checkFrozen(const std::string& name, const PointSet& set1, const PointSet& set2,
+                        const std::vector<Point>& others)
+{
+    FrozenPointSet frozen1(set1);
+    FrozenPointSet frozen2(set2);
+    std::vector<Point> points1(set1.begin(), set1.end());
+    sortPoints(points1);
+
+    // The iteration and the thawed PointSet round-trip the Points.
+    bool passed = checkFrozenPoints("iteration of " + name, frozen1, points1);
+    PointSet thawed = frozen1.thaw();
+    std::vector<Point> thawedPoints(thawed.begin(), thawed.end());
+    sortPoints(thawedPoints);
+    passed &= checkPoints("thaw of " + name, thawedPoints, points1);
+
+    // Every Point of the Set is found, and no other Point is.
+    for (const Point& point : points1)
+    {
+        if (!frozen1.contains(point))
+        {
+            std::cout << "ERROR: Fail test contains of " << name << ": " << point.toString()
+                      << std::endl;
+            return false;
+        }
+    }
+    for (const Point& point : others)
+    {
+        if (frozen1.contains(point))
+        {
+            std::cout << "ERROR: Fail test contains of " << name << ": " << point.toString()
+                      << std::endl;
+            return false;
+        }
+    }
+
+    // The operators are compared to the operators of the PointSets.
+    PointSet other = set2;
+    other.sortByMorton();
+    for (bool const intersect : {false, true})
+    {
+        PointSet result = intersect ? (set1 & other) : (set1 - other);
+        std::vector<Point> expected(result.begin(), result.end());
+        sortPoints(expected);
+        passed &= checkFrozenPoints((intersect ? "& of " : "- of ") + name,
+                                    intersect ? (frozen1 & frozen2) : (frozen1 - frozen2),
+                                    expected);
+    }
+    std::vector<Point> points2(set2.begin(), set2.end());
+    sortPoints(points2);
+    if ((frozen1 != FrozenPointSet(thawed)) || ((frozen1 == frozen2) != (points1 == points2)))
+    {
+        std::cout << "ERROR: Fail test == of " << name << std::endl;
+        passed = false;
+    }
+    return passed;
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The Main function that runs the test.
+ * @return 0 when all the tests passed, otherwise return a non-zero number.
+ */
+int main()
+{
+    std::mt19937 random(TEST_SEED);
+    bool passed = true;
+
+    // The first Set has sizes around the block size, and it is a part of the pool of the second.
+    for (bool const dense : {true, false})
+    {
+        for (int size : {0, 1, 2, 127, 128, 129, 256, 257, 1000, 20000})
+        {
+            std::vector<Point> pool = drawPool(random, POOL_FACTOR * size, dense);
+            size = std::min(size, (int) pool.size());
+            PointSet set1(pool.data(), size);
+            std::vector<Point> points2 = randomSubset(random, pool);
+            PointSet set2(points2.data(), (int) points2.size());
+            std::vector<Point> others(pool.begin() + size, pool.end());
+            passed &= checkFrozen(std::to_string(size) + (dense ? " dense" : " spread") +
+                                  " Points", set1, set2, others);
+        }
+    }
+
+    // 2 equal Sets.
+    std::vector<Point> pool = drawPool(random, EQUAL_SET_SIZE, false);
+    PointSet set(pool.data(), (int) pool.size());
+    passed &= checkFrozen("equal Sets", set, set, std::vector<Point>());
+
+    if (!passed)
+    {
+        return EXIT_FAILURE;
+    }
+    std::cout << "Pass FrozenPointSet tests." << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file TestPointSet.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Test for the cached state of the PointSet Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Test for the cached state of the PointSet Class.
+ * The PointSet keeps state which is updated by every change of the Set, instead of being
+ * calculated again. Every case changes a Set and compares it to a Set which is built from the
+ * expected Points, including removals of a Point by a reference to an element of the Set, which
+ * the removal itself overwrites. The extreme Points and the Convex Hull, which are cached between
+ * the changes, are checked as well, and the cached Hull is compared to a new Hull after every
+ * Point which is added to it.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "PointSet.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def GROWING_SET_SIZE 500
+ * @brief A Macro that sets the number of Points which are added to a Set with a cached Hull.
+ */
+#define GROWING_SET_SIZE 500
+
+/**
+ * @def GRID_WIDTH 21
+ * @brief A Macro that sets the width of the grid of the added Points, so many of them are
+ *        collinear with the edges of the Hull.
+ */
+#define GRID_WIDTH 21
+
+/**
+ * @def GRID_HEIGHT 23
+ * @brief A Macro that sets the height of the grid of the added Points.
+ */
+#define GRID_HEIGHT 23
+
+
+/*-----=  Test Helpers  =-----*/
+
+
+/**
+ * @brief Checks a changed PointSet against a PointSet of the expected Points.
+ * @param name The name of the test.
+ * @param set The changed PointSet.
+ * @param expected The PointSet of the expected Points.
+ * @return true if the Sets are equal, false otherwise.
+ */
+static bool checkSet(const std::string& name, const PointSet& set, const PointSet& expected)
+{
+    if (!(set == expected))
+    {
+        std::cout << "ERROR: Fail test " << name << std::endl;
+        std::cout << set.toString();
+        std::cout << "!=" << std::endl;
+        std::cout << expected.toString();
+        return false;
+    }
+    return true;
+}
+
+
+/*-----=  Test Cases  =-----*/
+
+
+/**
+ * @brief Removes the Points of a Set by references to its own elements, and compares the Set to
+ *        the Sets of the remaining Points, which have the same fingerprints only if the removed
+ *        Points were subtracted.
+ * @return true if the test passed, false otherwise.
+ */
+static bool testRemoveElement()
+{
+    Point points[] = {Point(1, 1), Point(5, 2), Point(3, 3)};
+    PointSet set(points, 3);
+    bool passed = set.remove(set[0]);
+    passed &= checkSet("remove first element", set, PointSet(points + 1, 2));
+    passed &= set.remove(set[set.size() - 1]);
+    passed &= checkSet("remove last element", set, PointSet(points + 1, 1));
+    passed &= set.remove(set[0]);
+    return checkSet("remove only element", set, PointSet()) && passed;
+}
+
+/**
+ * @brief Removes the Points of a Set with a cached Convex Hull by references to its own elements,
+ *        and compares the Hull to the Hull of the remaining Points.
+ * @return true if the test passed, false otherwise.
+ */
+static bool testRemoveHullElement()
+{
+    Point points[] = {Point(0, 0), Point(1, 1), Point(10, 0), Point(0, 10)};
+    PointSet set(points, 4);
+    set.convexHull();
+    bool passed = set.remove(set[0]);
+    passed &= checkSet("Hull after remove of a Hull element", set.convexHull(),
+                       PointSet(points + 1, 3));
+    passed &= set.remove(set[0]);
+    passed &= checkSet("Hull after remove of another Hull element", set.convexHull(),
+                       PointSet(points + 2, 2));
+    return passed;
+}
+
+/**
+ * @brief Removes the extreme Points of a Set by references to its own elements, and checks the
+ *        extreme Points and the bounding box of the remaining Points.
+ * @return true if the test passed, false otherwise.
+ */
+static bool testRemoveExtremeElement()
+{
+    Point points[] = {Point(0, 0), Point(5, 5), Point(10, 2), Point(2, 10)};
+    PointSet set(points, 4);
+    set.remove(set[0]);
+    if (!(set.extremePoint(LOWEST_POINT) == Point(10, 2)) ||
+        !(set.extremePoint(LEFTMOST_POINT) == Point(2, 10)) || set.mayContain(Point(0, 0)))
+    {
+        std::cout << "ERROR: Fail test extremes after remove of an extreme element" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Adds Points of a grid in a scattered order to a Set with a cached Convex Hull, and
+ *        compares the cached Hull, in its order, to the Hull of a new Set after every addition.
+ * @return true if the test passed, false otherwise.
+ */
+static bool testAddToHull()
+{
+    PointSet set;
+    set.convexHull();
+    std::vector<Point> points;
+    for (int i = 0; i < GROWING_SET_SIZE; i++)
+    {
+        Point point((Coordinate) (i * 37 % GRID_WIDTH), (Coordinate) (i * 53 % GRID_HEIGHT));
+        if (!set.add(point))
+        {
+            continue;
+        }
+        points.push_back(point);
+        PointSet cached = set.convexHull();
+        PointSet calculated = PointSet(points.data(), (int) points.size()).convexHull();
+        if (!std::equal(cached.begin(), cached.end(), calculated.begin()) ||
+            (cached.size() != calculated.size()))
+        {
+            std::cout << "ERROR: Fail test Hull after add of " << point.toString() << std::endl;
+            std::cout << cached.toString();
+            std::cout << "!=" << std::endl;
+            std::cout << calculated.toString();
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The Main function that runs the test.
+ * @return 0 when all the tests passed, otherwise return a non-zero number.
+ */
+int main()
+{
+    bool passed = testRemoveElement();
+    passed &= testRemoveHullElement();
+    passed &= testRemoveExtremeElement();
+    passed &= testAddToHull();
+
+    if (!passed)
+    {
+        return EXIT_FAILURE;
+    }
+    std::cout << "Pass PointSet tests." << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,190 @@
+/**
+ * @file TestPointSetOperations.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Test for the Set operations on many PointSets.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Test for the Set operations on many PointSets.
+ * Random Sets are drawn from a common pool of Points, so they overlap, and every operation is
+ * compared to the chain of the binary operators (or to the sorted Points for the union). The large
+ * Sets are operated with several numbers of threads, so the hash partitions are tested even on a
+ * single hardware thread, and the Points of every Set are shuffled, so a Point of a later Set may
+ * be scattered before the same Point of the first Set.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "PointSetOperations.h"
+#include "TestSupport.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def LARGE_POOL_SIZE 100000
+ * @brief A Macro that sets the number of Points in the pool of the large Sets, so the total size
+ *        of the large Sets is above the size of the parallel operations.
+ */
+#define LARGE_POOL_SIZE 100000
+
+/**
+ * @def SMALL_POOL_SIZE 2000
+ * @brief A Macro that sets the number of Points in the pool of the small Sets.
+ */
+#define SMALL_POOL_SIZE 2000
+
+/**
+ * @def MAX_SMALL_SETS 5
+ * @brief A Macro that sets the maximal number of small Sets in an operation.
+ */
+#define MAX_SMALL_SETS 5
+
+/**
+ * @def LARGE_SETS 3
+ * @brief A Macro that sets the number of large Sets in an operation.
+ */
+#define LARGE_SETS 3
+
+/**
+ * @def TEST_THREADS 4
+ * @brief A Macro that sets the number of threads for the special cases of the large Sets.
+ */
+#define TEST_THREADS 4
+
+
+/*-----=  Test Helpers  =-----*/
+
+
+/**
+ * @brief Draws random Sets from a pool of Points.
+ * @param random The random generator.
+ * @param pool The distinct Points to draw from.
+ * @param setCount The number of Sets.
+ * @return The Sets, each one with its Points in a random order.
+ */
+static std::vector<PointSet> randomSets(std::mt19937& random, const std::vector<Point>& pool,
+                                        int const setCount)
+{
+    std::vector<PointSet> sets;
+    for (int set = 0; set < setCount; set++)
+    {
+        std::vector<Point> points = randomSubset(random, pool);
+        std::shuffle(points.begin(), points.end(), random);
+        sets.push_back(PointSet(points.data(), (int) points.size()));
+    }
+    return sets;
+}
+
+/**
+ * @brief Checks a result of an operation against the expected result. The sorted Points are
+ *        compared, since the comparison operator searches the other Set for every Point.
+ * @param name The name of the test.
+ * @param result The result of the operation.
+ * @param expected The expected result.
+ * @return true if the result is right, false otherwise.
+ */
+static bool checkResult(const std::string& name, const PointSet& result, const PointSet& expected)
+{
+    std::vector<Point> resultPoints(result.begin(), result.end());
+    std::vector<Point> expectedPoints(expected.begin(), expected.end());
+    sortPoints(resultPoints);
+    sortPoints(expectedPoints);
+    return checkPoints(name, resultPoints, expectedPoints);
+}
+
+/**
+ * @brief Checks all the operations on the given Sets against the binary operators.
+ * @param sets The Sets.
+ * @param threads The number of threads for the operations.
+ * @return true if all the results are right, false otherwise.
+ */
+static bool checkOperations(const std::vector<PointSet>& sets, int const threads)
+{
+    std::vector<PointSetView> views(sets.begin(), sets.end());
+    std::string suffix = " of " + std::to_string(sets.size()) + " Sets with " +
+                         std::to_string(threads) + " threads";
+
+    // The union is compared to the sorted Points of all the Sets, without repetitions.
+    std::vector<Point> all;
+    for (const PointSet& set : sets)
+    {
+        all.insert(all.end(), set.begin(), set.end());
+    }
+    sortDistinct(all);
+    PointSet expectedUnion(all.data(), (int) all.size());
+
+    // The binary operators search the other Set by the Morton keys, instead of a linear search.
+    PointSet expectedIntersection = sets.front();
+    PointSet expectedDifference = sets.front();
+    for (size_t set = 1; set < sets.size(); set++)
+    {
+        PointSet other = sets[set];
+        other.sortByMorton();
+        expectedIntersection = expectedIntersection & other;
+        expectedDifference = expectedDifference - other;
+    }
+
+    bool passed = checkResult("unionAll" + suffix, unionAll(views, threads), expectedUnion);
+    passed &= checkResult("intersectAll" + suffix, intersectAll(views, threads),
+                          expectedIntersection);
+    passed &= checkResult("differenceAll" + suffix, differenceAll(views, threads),
+                          expectedDifference);
+    return passed;
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The Main function that runs the test.
+ * @return 0 when all the tests passed, otherwise return a non-zero number.
+ */
+int main()
+{
+    std::mt19937 random(TEST_SEED);
+    bool passed = true;
+
+    // Small Sets, which are always operated by a single thread.
+    std::vector<Point> smallPool = randomPool(random, SMALL_POOL_SIZE);
+    for (int setCount = 1; setCount <= MAX_SMALL_SETS; setCount++)
+    {
+        passed &= checkOperations(randomSets(random, smallPool, setCount), HARDWARE_THREADS);
+    }
+
+    // Large Sets, with numbers of threads which do and do not divide the number of Points.
+    std::vector<Point> largePool = randomPool(random, LARGE_POOL_SIZE);
+    std::vector<PointSet> largeSets = randomSets(random, largePool, LARGE_SETS);
+    for (int threads : {1, 2, 3, 4, 7})
+    {
+        passed &= checkOperations(largeSets, threads);
+    }
+
+    // An empty first Set, and a Set that contains all the others.
+    largeSets.front() = PointSet();
+    passed &= checkOperations(largeSets, TEST_THREADS);
+    largeSets.front() = PointSet(largePool.data(), (int) largePool.size());
+    passed &= checkOperations(largeSets, TEST_THREADS);
+
+    if (!passed)
+    {
+        return EXIT_FAILURE;
+    }
+    std::cout << "Pass Set operations tests." << std::endl;
+    return EXIT_SUCCESS;
+}
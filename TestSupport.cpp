@@ -0,0 +1,123 @@
+/**
+ * @file TestSupport.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the helpers of the randomized tests implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the helpers of the randomized tests implementation.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <iostream>
+#include "TestSupport.h"
+
+
+/*-----=  Test Helpers  =-----*/
+
+
+/**
+ * @brief Sorts Points by their X and then Y coordinates.
+ * @param points The Points to sort.
+ */
+void sortPoints(std::vector<Point>& points)
+{
+    std::sort(points.begin(), points.end(), [](const Point& point1, const Point& point2)
+              {
+                  return point1.lessByX(point2);
+              });
+}
+
+/**
+ * @brief Sorts Points by their X and then Y coordinates, and removes the repeated ones.
+ * @param points The Points to sort.
+ */
+void sortDistinct(std::vector<Point>& points)
+{
+    sortPoints(points);
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+}
+
+/**
+ * @brief Draws distinct random Points with the given coordinates.
+ * @param random The random generator.
+ * @param count The maximal number of Points.
+ * @param coordinate The function which draws a single coordinate.
+ * @return The distinct Points, in a random order.
+ */
+std::vector<Point> randomPool(std::mt19937& random, int const count,
+                              const std::function<Coordinate()>& coordinate)
+{
+    std::vector<Point> pool;
+    for (int i = 0; i < count; i++)
+    {
+        Coordinate x = coordinate();
+        pool.push_back(Point(x, coordinate()));
+    }
+    sortDistinct(pool);
+    std::shuffle(pool.begin(), pool.end(), random);
+    return pool;
+}
+
+/**
+ * @brief Draws distinct random Points with coordinates in [-COORDINATE_RANGE, COORDINATE_RANGE].
+ * @param random The random generator.
+ * @param count The maximal number of Points.
+ * @return The distinct Points, in a random order.
+ */
+std::vector<Point> randomPool(std::mt19937& random, int const count)
+{
+    std::uniform_int_distribution<int> coordinate(-COORDINATE_RANGE, COORDINATE_RANGE);
+    return randomPool(random, count, [&]()
+                      {
+                          return (Coordinate) coordinate(random);
+                      });
+}
+
+/**
+ * @brief Draws a random Set from a pool of Points, with every Point in it by SET_PROBABILITY.
+ * @param random The random generator.
+ * @param pool The distinct Points to draw from.
+ * @return The Points of the Set, in their order in the pool.
+ */
+std::vector<Point> randomSubset(std::mt19937& random, const std::vector<Point>& pool)
+{
+    std::bernoulli_distribution inSet(SET_PROBABILITY);
+    std::vector<Point> points;
+    for (const Point& point : pool)
+    {
+        if (inSet(random))
+        {
+            points.push_back(point);
+        }
+    }
+    return points;
+}
+
+/**
+ * @brief Checks Points against the expected Points, in their order.
+ * @param name The name of the test.
+ * @param points The Points.
+ * @param expected The expected Points.
+ * @return true if the Points are right, false otherwise.
+ */
+bool checkPoints(const std::string& name, const std::vector<Point>& points,
+                 const std::vector<Point>& expected)
+{
+    if (points != expected)
+    {
+        std::cout << "ERROR: Fail test " << name << " (" << points.size() << " Points instead of "
+                  << expected.size() << ")" << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file TestSupport.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the helpers of the randomized tests.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the helpers of the randomized tests.
+ * Declaring the functions which draw random pools of distinct Points and random Sets from them,
+ * and which compare Points to the expected Points. Every test seeds its random generator with
+ * TEST_SEED, so a failure repeats.
+ */
+
+
+#ifndef EX1_TESTSUPPORT_H
+#define EX1_TESTSUPPORT_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "Point.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def TEST_SEED 2016
+ * @brief A Macro that sets the seed of the random Sets, so a failure repeats.
+ */
+#define TEST_SEED 2016
+
+/**
+ * @def COORDINATE_RANGE 30000
+ * @brief A Macro that sets the range of the random coordinates, which fits every Coordinate type.
+ */
+#define COORDINATE_RANGE 30000
+
+/**
+ * @def SET_PROBABILITY 0.6
+ * @brief A Macro that sets the probability of a pool Point to be in a random Set.
+ */
+#define SET_PROBABILITY 0.6
+
+
+/*-----=  Test Helpers  =-----*/
+
+
+/**
+ * @brief Sorts Points by their X and then Y coordinates.
+ * @param points The Points to sort.
+ */
+void sortPoints(std::vector<Point>& points);
+
+/**
+ * @brief Sorts Points by their X and then Y coordinates, and removes the repeated ones.
+ * @param points The Points to sort.
+ */
+void sortDistinct(std::vector<Point>& points);
+
+/**
+ * @brief Draws distinct random Points with the given coordinates.
+ * @param random The random generator.
+ * @param count The maximal number of Points.
+ * @param coordinate The function which draws a single coordinate.
+ * @return The distinct Points, in a random order.
+ */
+std::vector<Point> randomPool(std::mt19937& random, int const count,
+                              const std::function<Coordinate()>& coordinate);
+
+/**
+ * @brief Draws distinct random Points with coordinates in [-COORDINATE_RANGE, COORDINATE_RANGE].
+ * @param random The random generator.
+ * @param count The maximal number of Points.
+ * @return The distinct Points, in a random order.
+ */
+std::vector<Point> randomPool(std::mt19937& random, int const count);
+
+/**
+ * @brief Draws a random Set from a pool of Points, with every Point in it by SET_PROBABILITY.
+ * @param random The random generator.
+ * @param pool The distinct Points to draw from.
+ * @return The Points of the Set, in their order in the pool.
+ */
+std::vector<Point> randomSubset(std::mt19937& random, const std::vector<Point>& pool);
+
+/**
+ * @brief Checks Points against the expected Points, in their order.
+ * @param name The name of the test.
+ * @param points The Points.
+ * @param expected The expected Points.
+ * @return true if the Points are right, false otherwise.
+ */
+bool checkPoints(const std::string& name, const std::vector<Point>& points,
+                 const std::vector<Point>& expected);
+
+
+#endif //EX1_TESTSUPPORT_H
@@ -0,0 +1,214 @@
+/**
+ * @file WindowedHull.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A File for the WindowedHull Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the WindowedHull Class implementation.
+ * Define the WindowedHull Class methods and fields.
+ * The Hulls of the blocks are kept as their Points sorted by their X and then Y coordinates, so 2
+ * Hulls are merged in linear time with the Monotone Chain.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cassert>
+#include "HullAlgorithms.h"
+#include "WindowedHull.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def EMPTY_WINDOW_SIZE 0
+ * @brief A Macro that sets the size for an empty window.
+ */
+#define EMPTY_WINDOW_SIZE 0
+
+
+/*-----=  Hull Helpers  =-----*/
+
+
+/**
+ * @brief A comparator function which compares 2 Points by their X and then Y coordinates.
+ * @param point1 The first Point to compare.
+ * @param point2 The second Point to compare.
+ * @return true if the first Point is smaller then the second Point.
+ */
+static bool xComparator(const Point& point1, const Point& point2)
+{
+    return point1.lessByX(point2);
+}
+
+/**
+ * @brief Calculate the Hull of a range of Points in O(n*log(n)).
+ * @param first The first Point of the range.
+ * @param last The Point after the last Point of the range.
+ * @return The Hull Points, sorted by their X and then Y coordinates.
+ */
+static std::vector<Point> rangeHull(std::vector<Point>::const_iterator const first,
+                                    std::vector<Point>::const_iterator const last)
+{
+    std::vector<Point> hull(first, last);
+    std::sort(hull.begin(), hull.end(), xComparator);
+    reduceToSortedHull(hull);
+    return hull;
+}
+
+
+/*-----=  WindowedHull Constructors  =-----*/
+
+
+/**
+ * @brief A Default Constructor for the WindowedHull, which create an empty window.
+ */
+WindowedHull::WindowedHull() : _frontStart(EMPTY_WINDOW_SIZE), _currentStart(EMPTY_WINDOW_SIZE),
+                               _size(EMPTY_WINDOW_SIZE)
+{
+
+}
+
+
+/*-----=  WindowedHull Methods  =-----*/
+
+
+/**
+ * @brief Adds a new Point to the new end of the window.
+ *        When the current block is full, its Hull is calculated and it is pushed to the back
+ *        stack, which merges it to the Hull of the back stack.
+ * @param point The new Point.
+ * @param time The time of the Point, which is not earlier than the time of the last Point.
+ */
+void WindowedHull::add(const Point& point, double const time)
+{
+    _current.points.push_back(point);
+    _current.times.push_back(time);
+    _size++;
+    if ((int) _current.points.size() < WINDOW_BLOCK_SIZE)
+    {
+        return;
+    }
+
+    // The expired Points of the current block are only kept while it is the oldest block.
+    _current.points.erase(_current.points.begin(), _current.points.begin() + _currentStart);
+    _current.times.erase(_current.times.begin(), _current.times.begin() + _currentStart);
+    _currentStart = EMPTY_WINDOW_SIZE;
+
+    _current.hull = rangeHull(_current.points.begin(), _current.points.end());
+    _backHull = _back.empty() ? _current.hull : mergeSortedHulls(_backHull, _current.hull);
+    _back.push_back(std::move(_current));
+    _current = Block();
+}
+
+/**
+ * @brief Returns the time of the oldest Point of the window, which must not be empty.
+ *        If the front stack is empty, the back stack is moved to it: the suffix Hulls are
+ *        calculated from the newest block to the oldest one, in O(h) for each block.
+ * @return The time of the oldest Point.
+ */
+double WindowedHull::_oldestTime()
+{
+    assert(_size > EMPTY_WINDOW_SIZE);
+    if (_front.empty() && !_back.empty())
+    {
+        std::vector<Point> suffixHull;
+        for (std::vector<Block>::reverse_iterator block = _back.rbegin(); block != _back.rend();
+             ++block)
+        {
+            suffixHull = mergeSortedHulls(block -> hull, suffixHull);
+            block -> suffixHull = suffixHull;
+            _front.push_front(std::move(*block));
+        }
+        _back.clear();
+        _backHull.clear();
+    }
+    return _front.empty() ? _current.times[_currentStart] : _front.front().times[_frontStart];
+}
+
+/**
+ * @brief Expires the oldest Point of the window, which must not be empty.
+ */
+void WindowedHull::_expireOldest()
+{
+    _oldestTime();
+    _size--;
+    if (_front.empty())
+    {
+        // The current block is the only block.
+        if (++_currentStart == (int) _current.points.size())
+        {
+            _current = Block();
+            _currentStart = EMPTY_WINDOW_SIZE;
+        }
+        return;
+    }
+    if (++_frontStart == (int) _front.front().points.size())
+    {
+        _front.pop_front();
+        _frontStart = EMPTY_WINDOW_SIZE;
+    }
+}
+
+/**
+ * @brief Expires the oldest Points, until the window has at most the given number of Points.
+ * @param count The maximal number of Points to keep.
+ */
+void WindowedHull::keepLatest(int const count)
+{
+    while (_size > count)
+    {
+        _expireOldest();
+    }
+}
+
+/**
+ * @brief Expires all the Points which are earlier than the given time.
+ * @param time The time of the oldest Points to keep.
+ */
+void WindowedHull::expireBefore(double const time)
+{
+    while ((_size > EMPTY_WINDOW_SIZE) && (_oldestTime() < time))
+    {
+        _expireOldest();
+    }
+}
+
+/**
+ * @brief Calculate the Convex Hull of the Points in the window.
+ *        The Hull is merged from the Hull of the live Points of the oldest front block, the suffix
+ *        Hull of the next front block, the Hull of the back stack and the Hull of the live Points
+ *        of the current block.
+ * @return A PointSet which contains the Convex Hull Points, in Counter-Clockwise order starting
+ *         from the lowest Point.
+ */
+PointSet WindowedHull::hull() const
+{
+    std::vector<Point> hull = rangeHull(_current.points.begin() + _currentStart,
+                                        _current.points.end());
+    hull = mergeSortedHulls(hull, _backHull);
+    if (!_front.empty())
+    {
+        const Block& oldest = _front.front();
+        hull = mergeSortedHulls(hull, (_frontStart == EMPTY_WINDOW_SIZE) ?
+                                      oldest.hull :
+                                      rangeHull(oldest.points.begin() + _frontStart,
+                                                oldest.points.end()));
+        if (_front.size() > 1)
+        {
+            hull = mergeSortedHulls(hull, _front[1].suffixHull);
+        }
+    }
+
+    // The merged Hull is sorted, so the Monotone Chain puts it in Counter-Clockwise order.
+    return getSortedConvexHull(hull.data(), (int) hull.size());
+}
@@ -0,0 +1,133 @@
+/**
+ * @file WindowedHull.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 04 Sep 2016
+ *
+ * @brief A Header File for the WindowedHull Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the WindowedHull Class.
+ * Declaring the WindowedHull Class, it's methods and fields.
+ * A WindowedHull holds a sliding window of a stream of Points, where the Points enter at the new
+ * end and expire from the old end, and calculates the Convex Hull of the Points in the window
+ * without calculating it from all of them again.
+ */
+
+
+#ifndef EX1_WINDOWEDHULL_H
+#define EX1_WINDOWEDHULL_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <deque>
+#include <vector>
+#include "PointSet.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def WINDOW_BLOCK_SIZE 256
+ * @brief A Macro that sets the number of Points in a block of the window.
+ */
+#define WINDOW_BLOCK_SIZE 256
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a sliding window of a stream of Points and its Convex Hull.
+ *        The window is a queue of blocks of Points, and the Hull of each full block is calculated
+ *        once. The queue is made of 2 stacks of blocks: the new blocks are pushed to the back
+ *        stack, which keeps the Hull of all its blocks, and the old blocks are popped from the
+ *        front stack, which keeps for each block the Hull of it and all the newer front blocks.
+ *        When the front stack is empty, the back stack is moved to it.
+ *        Adding or expiring a Point takes O(log(B) + h/B) amortized time for blocks of B Points
+ *        and Hulls of h Points, and the Hull of the window takes O(B*log(B) + h).
+ *        The same Point may enter the window several times.
+ */
+class WindowedHull
+{
+public:
+
+    /**
+     * @brief A Default Constructor for the WindowedHull, which create an empty window.
+     */
+    WindowedHull();
+
+    /**
+     * @brief Returns the size of the window, i.e. the number of Points in it (with repetitions).
+     * @return The size of the window.
+     */
+    int size() const { return _size; };
+
+    /**
+     * @brief Adds a new Point to the new end of the window.
+     * @param point The new Point.
+     * @param time The time of the Point, which is not earlier than the time of the last Point.
+     */
+    void add(const Point& point, double const time);
+
+    /**
+     * @brief Expires the oldest Points, until the window has at most the given number of Points.
+     * @param count The maximal number of Points to keep.
+     */
+    void keepLatest(int const count);
+
+    /**
+     * @brief Expires all the Points which are earlier than the given time.
+     * @param time The time of the oldest Points to keep.
+     */
+    void expireBefore(double const time);
+
+    /**
+     * @brief Calculate the Convex Hull of the Points in the window.
+     * @return A PointSet which contains the Convex Hull Points, in Counter-Clockwise order starting
+     *         from the lowest Point.
+     */
+    PointSet hull() const;
+
+private:
+
+    /**
+     * @brief A block of consecutive Points of the window.
+     */
+    struct Block
+    {
+        std::vector<Point> points;  // The Points of the block, from the oldest.
+        std::vector<double> times;  // The times of the Points.
+        std::vector<Point> hull;  // The Hull of all the Points of the block.
+        std::vector<Point> suffixHull;  // In the front stack, the Hull with all the newer blocks.
+    };
+
+    // WindowedHull Private Fields.
+    std::deque<Block> _front;  // The front stack of blocks, from the oldest.
+    std::vector<Block> _back;  // The back stack of full blocks, from the oldest.
+    std::vector<Point> _backHull;  // The Hull of all the blocks of the back stack.
+    Block _current;  // The block which the new Points are added to.
+    int _frontStart;  // The number of expired Points of the oldest front block.
+    int _currentStart;  // The number of expired Points of the current block.
+    int _size;  // The number of Points in the window.
+
+    /**
+     * @brief Returns the time of the oldest Point of the window, which must not be empty.
+     * @return The time of the oldest Point.
+     */
+    double _oldestTime();
+
+    /**
+     * @brief Expires the oldest Point of the window, which must not be empty.
+     */
+    void _expireOldest();
+};
+
+
+#endif //EX1_WINDOWEDHULL_H